@@ -14,14 +14,26 @@
  * limitations under the License.
  */
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
+#include <unordered_map>
+#include <stdexcept>
 
 #include "Poco/Net/HTTPResponse.h"
 
 #include "raven/net/RouterHTTP.h"
 #include "raven/net/WebSocketDispatcher.h"
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/SessionStatsReport.h"
+#include "raven/net/ServerRequestProviderHTTP.h"
+#include "raven/net/RouteTree.h"
+#include "raven/net/StaticRouteTable.h"
+#include "raven/net/MiddlewareChain.h"
 
 
 namespace raven {
@@ -30,6 +42,15 @@ namespace net {
 using std::unique_ptr;
 using std::shared_ptr;
 using std::make_unique;
+using std::make_shared;
+using std::size_t;
+using std::int64_t;
+using std::vector;
+using std::string;
+using std::string_view;
+using std::unordered_map;
+using std::pair;
+using std::runtime_error;
 using std::bind;
 using std::placeholders::_1;
 using std::placeholders::_2;
@@ -40,6 +61,59 @@ BasicRouterHTTP::BasicRouterHTTP(){ }
 
 void BasicRouterHTTP::initialize(){
     defineRoutes();
+    shared_ptr<RouteTree> tree = make_shared<RouteTree>();
+    vector<pair<string, size_t>> literals;
+    unordered_map<string, size_t> indices;
+    _routeTables.clear();
+    auto tableOf = [&](const string& path) -> RouteTable& {
+        auto item = indices.find(path);
+        if(item != indices.end()){
+            return _routeTables[item->second];
+        }
+        if(path.find_first_of("{*") == string::npos){
+            literals.emplace_back(path, _routeTables.size());
+        }else{
+            tree->insert(path, _routeTables.size());
+        }
+        indices[path] = _routeTables.size();
+        _routeTables.emplace_back();
+        return _routeTables.back();
+    };
+    for(const auto& route : routes){
+        RouteTable& table = tableOf(route.first);
+        table.any.handler = route.second;
+        auto options = _routeOptions.find(route.first);
+        if(options != _routeOptions.end()){
+            table.any.options = options->second;
+        }
+    }
+    for(const auto& route : _methodRoutes){
+        RouteTable& table = tableOf(route.first);
+        for(const auto& handler : route.second){
+            table.methods[static_cast<size_t>(handler.first)] = handler.second;
+        }
+        //HEAD requests are answered like GET requests unless the
+        //route defines its own handler. The server omits the body
+        RouteEntry& head =
+            table.methods[static_cast<size_t>(MethodHTTP::HTTP_HEAD)];
+
+        const RouteEntry& get =
+            table.methods[static_cast<size_t>(MethodHTTP::HTTP_GET)];
+
+        if(!head.handler && get.handler){
+            head = get;
+        }
+        for(size_t i = 0; i < METHOD_HTTP_COUNT; ++i){
+            if(table.methods[i].handler){
+                if(!table.allow.empty()){
+                    table.allow += ", ";
+                }
+                table.allow += toString(static_cast<MethodHTTP>(i));
+            }
+        }
+    }
+    _staticRoutes = make_shared<StaticRouteTable>(literals);
+    _routeTree = tree;
 }
 
 void BasicRouterHTTP::staticRoute(
@@ -47,18 +121,112 @@ void BasicRouterHTTP::staticRoute(
     std::function<void(RequestHTTP&, ResponseHTTP&)> method){
 
     routes[path] = method;
+    _routeOptions.erase(path);
+}
+
+void BasicRouterHTTP::staticRoute(
+    const std::string& path,
+    std::function<void(RequestHTTP&, ResponseHTTP&)> method,
+    const RouteOptions& options){
+
+    routes[path] = method;
+    _routeOptions[path] = options;
+}
+
+void BasicRouterHTTP::staticRoute(
+    MethodHTTP httpMethod,
+    const std::string& path,
+    std::function<void(RequestHTTP&, ResponseHTTP&)> method){
+
+    staticRoute(httpMethod, path, method, RouteOptions());
+}
+
+void BasicRouterHTTP::staticRoute(
+    MethodHTTP httpMethod,
+    const std::string& path,
+    std::function<void(RequestHTTP&, ResponseHTTP&)> method,
+    const RouteOptions& options){
+
+    if(httpMethod == MethodHTTP::HTTP_OTHER){
+        throw runtime_error("Cannot define a route for an unknown HTTP method");
+    }
+    _methodRoutes[path].emplace_back(httpMethod, RouteEntry{method, options});
+}
+
+void BasicRouterHTTP::sessionStatsRoute(const std::string& path){
+    routes[path] = &SessionStatsReport::handle;
 }
 
 void BasicRouterHTTP::webSocketRoute(
     const std::string& path,
     WebSocketController& controller){
 
-    wsDispatchers.emplace_back(WebSocketDispatcher(controller));
+    webSocketRoute(path, controller, WebSocketOptions());
+}
+
+void BasicRouterHTTP::webSocketRoute(
+    const std::string& path,
+    WebSocketController& controller,
+    const WebSocketOptions& options){
+
+    _webSocketRoute(path, WebSocketControllerBinding::of(controller), options);
+}
+
+void BasicRouterHTTP::_webSocketRoute(
+    const std::string& path,
+    const WebSocketControllerBinding& binding,
+    const WebSocketOptions& options){
+
+    wsDispatchers.emplace_back(WebSocketDispatcher(binding, options));
     WebSocketDispatcher& dispatcher = wsDispatchers.back();
     routes[path] = bind(&WebSocketDispatcher::dispatch, dispatcher, _1, _2);
 }
 
+void BasicRouterHTTP::middleware(Middleware middleware){
+    if(_routeTree){
+        throw runtime_error("Cannot add middleware after initialization");
+    }
+    _middleware.push_back(middleware);
+}
+
 void BasicRouterHTTP::route(RequestHTTP& request, ResponseHTTP& response){
+    if(_middleware.empty()){
+        _dispatch(request, response);
+        return;
+    }
+    MiddlewareChain chain(*this);
+    chain.proceed(request, response);
+}
+
+void BasicRouterHTTP::_dispatch(RequestHTTP& request, ResponseHTTP& response){
+    if(_routeTree){
+        vector<PathParam>& params = request.getProvider().getPathParams();
+        params.clear();
+        const string_view path = request.getURIpathView();
+        //Literal paths always take priority over patterns
+        size_t index = _staticRoutes->find(path);
+        if(index == StaticRouteTable::NO_ROUTE){
+            index = _routeTree->find(path, params);
+        }
+        if(index == RouteTree::NO_ROUTE){
+            onError404(request, response);
+            return;
+        }
+        const RouteTable& table = _routeTables[index];
+        const RouteEntry& entry =
+            table.methods[static_cast<size_t>(request.getMethodType())];
+
+        if(entry.handler){
+            _invoke(entry, request, response);
+        }else if(table.any.handler){
+            _invoke(table.any, request, response);
+        }else{
+            response.setHeader("Allow", table.allow);
+            onError405(request, response);
+        }
+        return;
+    }
+    //Routes have not been compiled by initialize()
     auto route = routes.find(request.getURIpath());
     if(route == routes.end()){
         onError404(request, response);
@@ -73,5 +241,43 @@ void BasicRouterHTTP::onError404(RequestHTTP& request, ResponseHTTP& response){
             .body("Error 404: Not Found");
 }
 
+void BasicRouterHTTP::_invoke(
+    const RouteEntry& entry,
+    RequestHTTP& request,
+    ResponseHTTP& response){
+
+    const size_t maxBodySize = entry.options.maxBodySize;
+    if(maxBodySize == 0){
+        entry.handler(request, response);
+        return;
+    }
+    request.getProvider().setMaxBodySize(maxBodySize);
+    if(request.getContentLength() > static_cast<int64_t>(maxBodySize)){
+        //Reject the request before any of the body is read
+        response.setHeader("Connection", "close");
+        onError413(request, response);
+        return;
+    }
+    try{
+        entry.handler(request, response);
+    }catch(const PayloadTooLargeException& ex){
+        if(response.isSent()){
+            throw;
+        }
+        response.setHeader("Connection", "close");
+        onError413(request, response);
+    }
+}
+
+void BasicRouterHTTP::onError405(RequestHTTP& request, ResponseHTTP& response){
+    response.setStatus(HTTPResponse::HTTPStatus::HTTP_METHOD_NOT_ALLOWED)
+            .body("Error 405: Method Not Allowed");
+}
+
+void BasicRouterHTTP::onError413(RequestHTTP& request, ResponseHTTP& response){
+    response.setStatus(HTTPResponse::HTTPStatus::HTTP_REQUEST_ENTITY_TOO_LARGE)
+            .body("Error 413: Payload Too Large");
+}
+
 } // END NAMESPACE net
 } // END NAMESPACE raven
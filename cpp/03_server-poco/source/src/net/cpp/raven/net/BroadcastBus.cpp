@@ -0,0 +1,505 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <cerrno>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "raven/net/BroadcastBus.h"
+#include "raven/net/Message.h"
+#include "raven/net/SessionHandler.h"
+#include "raven/util/Log.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint32_t;
+using std::uint64_t;
+using std::string;
+using std::atomic;
+using std::thread;
+using std::shared_mutex;
+using std::shared_lock;
+using std::unique_lock;
+using std::runtime_error;
+using raven::util::Log;
+
+/**
+ * The header at the start of the shared memory region. A newly created
+ * region is zero-filled, so the initial state is STATE_EMPTY and
+ * the initial write cursor is zero. The signal counter is incremented
+ * after each published message. Readers which have caught up block on it.
+ */
+struct BroadcastRingHeader {
+    atomic<uint32_t> state;
+    uint32_t slotCount;
+    uint32_t slotSize;
+    uint32_t reserved;
+    alignas(64) atomic<uint64_t> writeCursor;
+    atomic<uint32_t> signal;
+    atomic<uint32_t> waiters;
+};
+
+/**
+ * The header of each slot in the ring. The version is a sequence lock:
+ * it is 2*seq+1 while the message with sequence number seq is written
+ * and 2*seq+2 once it is complete. A writer claims the slot by changing
+ * the version to the odd value, so the version never moves backwards and
+ * two writers never write the same slot at the same time. The group name
+ * and message bytes directly follow the header.
+ */
+struct BroadcastSlotHeader {
+    atomic<uint64_t> version;
+    uint64_t origin;
+    uint32_t groupLength;
+    uint32_t messageLength;
+};
+
+static_assert(
+    atomic<uint64_t>::is_always_lock_free,
+    "BroadcastBus requires lock-free 64-bit atomics");
+
+static_assert(
+    atomic<uint32_t>::is_always_lock_free
+    && sizeof(atomic<uint32_t>) == sizeof(uint32_t),
+    "BroadcastBus requires lock-free 32-bit atomics");
+
+static const uint32_t BB_STATE_EMPTY = 0;
+static const uint32_t BB_STATE_INITIALIZING = 1;
+static const uint32_t BB_STATE_READY = 2;
+static const size_t BB_HEADER_SIZE = 128;
+static const size_t BB_SLOT_ALIGNMENT = 64;
+static const unsigned int BB_OPEN_ATTEMPTS = 1000;
+static const unsigned int BB_CLAIM_ATTEMPTS = 1000;
+static const char* BB_NAME_PREFIX = "/raven-broadcast-";
+
+static_assert(
+    sizeof(BroadcastRingHeader) <= BB_HEADER_SIZE,
+    "BroadcastBus ring header does not fit");
+
+/**
+ * Indicates whether the shared memory object with the specified name
+ * still refers to the file described by the specified stat info.
+ */
+static bool bbIsCurrent(const string& path, const struct stat& info){
+    const int fd = shm_open(path.c_str(), O_RDONLY, 0);
+    if(fd < 0){
+        return false;
+    }
+    struct stat current;
+    const bool same = (fstat(fd, &current) == 0)
+        && (current.st_dev == info.st_dev)
+        && (current.st_ino == info.st_ino);
+
+    ::close(fd);
+    return same;
+}
+
+/**
+ * Signals a published message to all blocked readers of all processes.
+ */
+static void bbNotify(BroadcastRingHeader* header){
+    header->signal.fetch_add(1);
+#if defined(__linux__)
+    if(header->waiters.load() != 0){
+        syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(&header->signal),
+            FUTEX_WAKE,
+            INT_MAX,
+            nullptr,
+            nullptr,
+            0);
+    }
+#endif
+}
+
+static runtime_error bbError(const string& message){
+    return runtime_error(
+        "BroadcastBus: " + message + ": " + std::strerror(errno));
+}
+
+BroadcastBus::BroadcastBus(const string& name)
+    :BroadcastBus(name, DEFAULT_SLOT_COUNT, DEFAULT_SLOT_SIZE){ }
+
+BroadcastBus::BroadcastBus(
+    const string& name,
+    size_t slotCount,
+    size_t slotSize):
+
+    _name(name),
+    _slotCount(slotCount),
+    _slotSize(slotSize),
+    _origin((static_cast<uint64_t>(std::random_device()()) << 32)
+            ^ std::random_device()()),
+    _isRunning(false),
+    _lost(0){
+
+    if(name.empty() || name.find('/') != string::npos){
+        throw runtime_error("BroadcastBus: Invalid name");
+    }
+    if(slotCount == 0 || (slotCount & (slotCount - 1)) != 0
+        || slotCount > UINT32_MAX){
+
+        throw runtime_error("BroadcastBus: Slot count must be a power of two");
+    }
+    if(slotSize == 0 || slotSize > UINT32_MAX){
+        throw runtime_error("BroadcastBus: Invalid slot size");
+    }
+    const size_t size = sizeof(BroadcastSlotHeader) + slotSize;
+    _stride = ((size + BB_SLOT_ALIGNMENT - 1) / BB_SLOT_ALIGNMENT)
+              * BB_SLOT_ALIGNMENT;
+}
+
+BroadcastBus::~BroadcastBus(){
+    stop();
+}
+
+void BroadcastBus::start(){
+    const unique_lock<shared_mutex> lock(_mutex);
+    if(_isRunning){
+        return;
+    }
+    _open();
+    BroadcastRingHeader* header =
+        reinterpret_cast<BroadcastRingHeader*>(_memory);
+
+    uint32_t state = BB_STATE_EMPTY;
+    if(header->state.compare_exchange_strong(state, BB_STATE_INITIALIZING)){
+        header->slotCount = static_cast<uint32_t>(_slotCount);
+        header->slotSize = static_cast<uint32_t>(_slotSize);
+        header->state.store(BB_STATE_READY, std::memory_order_release);
+    }else{
+        //The process which created the region is initializing it
+        for(unsigned int i = 0; i < BB_OPEN_ATTEMPTS; ++i){
+            if(header->state.load(std::memory_order_acquire)
+                == BB_STATE_READY){
+
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if(header->state.load(std::memory_order_acquire) != BB_STATE_READY
+        || header->slotCount != _slotCount
+        || header->slotSize != _slotSize){
+
+        _close();
+        throw runtime_error(
+            "BroadcastBus: Shared memory region '" + _name
+            + "' is in use with a different configuration");
+    }
+    _slots = _memory + BB_HEADER_SIZE;
+    _cursor = header->writeCursor.load(std::memory_order_acquire);
+    _isRunning = true;
+    _reader = thread(&BroadcastBus::_readerLoop, this);
+}
+
+void BroadcastBus::stop(){
+    const unique_lock<shared_mutex> lock(_mutex);
+    if(!_isRunning.exchange(false)){
+        return;
+    }
+    bbNotify(reinterpret_cast<BroadcastRingHeader*>(_memory));
+    if(_reader.joinable()){
+        _reader.join();
+    }
+    _slots = nullptr;
+    _close();
+}
+
+bool BroadcastBus::isRunning() const{
+    return _isRunning;
+}
+
+bool BroadcastBus::publish(const string& message){
+    return publish(string(), message);
+}
+
+bool BroadcastBus::publish(const string& group, const string& message){
+    {
+        const shared_lock<shared_mutex> lock(_mutex);
+        if(!_isRunning || !_write(group, message)){
+            return false;
+        }
+    }
+    deliver(group, message);
+    return true;
+}
+
+uint64_t BroadcastBus::getLostMessages() const{
+    return _lost;
+}
+
+string BroadcastBus::getName() const{
+    return _name;
+}
+
+void BroadcastBus::deliver(const string& group, const string& message){
+    SessionHandler& handler = SessionHandler::getInstance();
+    if(group.empty()){
+        handler.sendToAll(message, MessagePriority::INTERACTIVE);
+    }else{
+        handler.sendToGroup(group, message, MessagePriority::INTERACTIVE);
+    }
+}
+
+void BroadcastBus::_open(){
+    const string path = BB_NAME_PREFIX + _name;
+    const size_t size = BB_HEADER_SIZE + (_slotCount * _stride);
+    for(unsigned int i = 0; i < BB_OPEN_ATTEMPTS; ++i){
+        int fd = shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if(fd >= 0){
+            //This process creates the region. It is zero-filled
+            if(ftruncate(fd, static_cast<off_t>(size)) != 0){
+                const runtime_error error = bbError("Cannot size shared memory");
+                shm_unlink(path.c_str());
+                ::close(fd);
+                throw error;
+            }
+        }else if(errno == EEXIST){
+            fd = shm_open(path.c_str(), O_RDWR, 0);
+            if(fd < 0){
+                if(errno == ENOENT){
+                    //Removed by its last user in the meantime
+                    continue;
+                }
+                throw bbError("Cannot open shared memory");
+            }
+        }else{
+            throw bbError("Cannot create shared memory");
+        }
+        //Each user holds a shared lock. If the last user is currently
+        //removing the region, this blocks until it is done, in which
+        //case the name no longer refers to the opened region
+        struct stat info;
+        if(flock(fd, LOCK_SH) != 0 || fstat(fd, &info) != 0){
+            const runtime_error error = bbError("Cannot lock shared memory");
+            ::close(fd);
+            throw error;
+        }
+        if(!bbIsCurrent(path, info)){
+            ::close(fd);
+            continue;
+        }
+        if(info.st_size == 0){
+            //Created by another process which has not sized it yet
+            ::close(fd);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        if(static_cast<size_t>(info.st_size) != size){
+            ::close(fd);
+            throw runtime_error(
+                "BroadcastBus: Shared memory region '" + _name
+                + "' is in use with a different configuration");
+        }
+        void* memory = mmap(
+            nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        if(memory == MAP_FAILED){
+            const runtime_error error = bbError("Cannot map shared memory");
+            ::close(fd);
+            throw error;
+        }
+        _fd = fd;
+        _memory = static_cast<char*>(memory);
+        _size = size;
+        return;
+    }
+    throw runtime_error(
+        "BroadcastBus: Shared memory region '" + _name + "' is not available");
+}
+
+void BroadcastBus::_close(){
+    munmap(_memory, _size);
+    _memory = nullptr;
+    _size = 0;
+    //The last user removes the region. Any process which opens it in
+    //the meantime blocks on its shared lock until the descriptor is
+    //closed and then detects that the region was removed
+    if(flock(_fd, LOCK_EX | LOCK_NB) == 0){
+        const string path = BB_NAME_PREFIX + _name;
+        struct stat info;
+        if(fstat(_fd, &info) == 0 && bbIsCurrent(path, info)){
+            shm_unlink(path.c_str());
+        }
+    }
+    ::close(_fd);
+    _fd = -1;
+}
+
+bool BroadcastBus::_write(const string& group, const string& message){
+    if(group.size() + message.size() > _slotSize){
+        return false;
+    }
+    BroadcastRingHeader* header =
+        reinterpret_cast<BroadcastRingHeader*>(_memory);
+
+    const uint64_t seq = header->writeCursor.fetch_add(
+        1, std::memory_order_acq_rel);
+
+    BroadcastSlotHeader* slot = reinterpret_cast<BroadcastSlotHeader*>(
+        _slots + ((seq & (_slotCount - 1)) * _stride));
+
+    char* data = reinterpret_cast<char*>(slot) + sizeof(BroadcastSlotHeader);
+    const uint64_t busy = (2 * seq) + 1;
+    uint64_t version = slot->version.load(std::memory_order_acquire);
+    unsigned int attempts = 0;
+    while(true){
+        if(version >= busy){
+            //A writer that has lapped this one already claimed the slot,
+            //readers count this message as lost
+            return true;
+        }
+        if((version & 1) != 0){
+            //A writer of the previous lap is still busy with the slot.
+            //Give up if it does not finish, e.g. because it has died
+            if(++attempts > BB_CLAIM_ATTEMPTS){
+                return false;
+            }
+            std::this_thread::yield();
+            version = slot->version.load(std::memory_order_acquire);
+        }else if(slot->version.compare_exchange_weak(
+                    version, busy, std::memory_order_acquire)){
+            break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->origin = _origin;
+    slot->groupLength = static_cast<uint32_t>(group.size());
+    slot->messageLength = static_cast<uint32_t>(message.size());
+    std::memcpy(data, group.data(), group.size());
+    std::memcpy(data + group.size(), message.data(), message.size());
+    slot->version.store((2 * seq) + 2, std::memory_order_release);
+    bbNotify(header);
+    return true;
+}
+
+void BroadcastBus::_await(uint32_t signal){
+#if defined(__linux__)
+    BroadcastRingHeader* header =
+        reinterpret_cast<BroadcastRingHeader*>(_memory);
+
+    //Registering as a waiter before the futex checks the signal value
+    //ensures that a writer which increments it also wakes this reader
+    header->waiters.fetch_add(1);
+    if(_isRunning.load()){
+        syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(&header->signal),
+            FUTEX_WAIT,
+            signal,
+            nullptr,
+            nullptr,
+            0);
+    }
+    header->waiters.fetch_sub(1);
+#else
+    (void) signal;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+}
+
+void BroadcastBus::_readerLoop(){
+    BroadcastRingHeader* header =
+        reinterpret_cast<BroadcastRingHeader*>(_memory);
+
+    string group;
+    string message;
+    while(true){
+        //Observe the signal before the slot so that a message which
+        //is published in between makes the following wait return
+        const uint32_t signal = header->signal.load();
+        if(!_isRunning.load()){
+            break;
+        }
+        BroadcastSlotHeader* slot = reinterpret_cast<BroadcastSlotHeader*>(
+            _slots + ((_cursor & (_slotCount - 1)) * _stride));
+
+        const char* data =
+            reinterpret_cast<const char*>(slot) + sizeof(BroadcastSlotHeader);
+
+        const uint64_t expected = (2 * _cursor) + 2;
+        const uint64_t version = slot->version.load(std::memory_order_acquire);
+        bool overrun = version > expected;
+        if(version < expected){
+            //Not written yet. If the writers have lapped this reader,
+            //e.g. because a writer died while writing, skip ahead
+            const uint64_t head =
+                header->writeCursor.load(std::memory_order_acquire);
+
+            if(head <= _cursor + _slotCount){
+                _await(signal);
+                continue;
+            }
+            overrun = true;
+        }
+        if(!overrun){
+            const uint64_t origin = slot->origin;
+            const size_t groupLength = slot->groupLength;
+            const size_t messageLength = slot->messageLength;
+            const bool valid = (groupLength + messageLength) <= _slotSize;
+            if(valid){
+                group.assign(data, groupLength);
+                message.assign(data + groupLength, messageLength);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot->version.load(std::memory_order_relaxed) == expected){
+                ++_cursor;
+                if(valid && origin != _origin){
+                    deliver(group, message);
+                }
+                continue;
+            }
+        }
+        //Slot was overwritten, skip to the oldest message still in the ring
+        const uint64_t head = header->writeCursor.load(std::memory_order_acquire);
+        uint64_t target = (head > _slotCount) ? (head - _slotCount + 1) : 0;
+        if(target <= _cursor){
+            target = _cursor + 1;
+        }
+        _lost += (target - _cursor);
+        _cursor = target;
+        Log::warn("BroadcastBus: Reader fell behind, messages were skipped");
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -53,8 +53,9 @@ HTTPRequestHandler* DefaultRequestHandlerFactory::createRequestHandler(
       + " "
       + request.getVersion());
 
-    if(request.find("Upgrade") != request.end()
-        && Poco::icompare(request["Upgrade"], "websocket") == 0){
+    auto upgrade = request.find("Upgrade");
+    if(upgrade != request.end()
+        && Poco::icompare(upgrade->second, "websocket") == 0){
 
         return new WebSocketRequestHandler(_router);
     }else{
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include "Poco/Exception.h"
+#include "Poco/File.h"
+#include "Poco/SharedMemory.h"
+
+#include "raven/net/FileTransfer.h"
+#include "raven/net/WebSocketSessionProvider.h"
+#include "raven/net/Message.h"
+#include "raven/util/Log.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::shared_ptr;
+using std::make_shared;
+using std::lock_guard;
+using std::mutex;
+using std::string;
+using std::runtime_error;
+using Poco::File;
+using Poco::SharedMemory;
+using raven::util::Log;
+
+FileTransfer::FileTransfer(
+    shared_ptr<WebSocketSessionProvider> session,
+    const string& path,
+    MessagePriority priority,
+    ProgressCallback onProgress,
+    SendCallback onComplete)
+    :_session(session),
+     _chunkSize(session->getOptions().fileChunkSize),
+     _priority(priority),
+     _onProgress(onProgress),
+     _onComplete(onComplete){
+
+    if(_chunkSize == 0){
+        throw runtime_error("Invalid file chunk size");
+    }
+    try{
+        File file(path);
+        if(!file.exists() || !file.isFile()){
+            throw runtime_error("Cannot send file '" + path + "': Not a file");
+        }
+        _size = static_cast<size_t>(file.getSize());
+        if(_size > 0){
+            //Empty files cannot be mapped
+            _mapping = make_shared<SharedMemory>(file, SharedMemory::AM_READ);
+            _data = _mapping->begin();
+        }
+    }catch(const Poco::Exception& ex){
+        throw runtime_error(
+            "Cannot send file '" + path + "': " + ex.displayText());
+    }
+}
+
+void FileTransfer::start(size_t window){
+    if(_size == 0){
+        //Send a single empty message so that the client sees the file
+        shared_ptr<WebSocketSessionProvider> session = _session.lock();
+        if(!session){
+            _onChunk(SendStatus::DROPPED, 0);
+            return;
+        }
+        shared_ptr<FileTransfer> self = shared_from_this();
+        session->sendMessage(
+            make_shared<Message>(4, string()),
+            _priority,
+            [self](SendStatus status, size_t){
+                self->_onChunk(status, 0);
+            });
+        return;
+    }
+    for(size_t i = 0; i < std::max(window, size_t(1)); ++i){
+        _sendNext();
+    }
+}
+
+size_t FileTransfer::getSize() const{
+    return _size;
+}
+
+void FileTransfer::_sendNext(){
+    size_t offset;
+    size_t length;
+    {
+        const lock_guard<mutex> lock(_mutex);
+        if(_isDone || _queued >= _size){
+            return;
+        }
+        offset = _queued;
+        length = std::min(_chunkSize, _size - offset);
+        _queued += length;
+    }
+    shared_ptr<WebSocketSessionProvider> session = _session.lock();
+    if(!session){
+        _onChunk(SendStatus::DROPPED, length);
+        return;
+    }
+    //The chunk shares ownership of the whole mapping
+    shared_ptr<const char> chunk(_mapping, _data + offset);
+    shared_ptr<FileTransfer> self = shared_from_this();
+    session->sendMessage(
+        make_shared<Message>(4, chunk, length),
+        _priority,
+        [self, length](SendStatus status, size_t){
+            self->_onChunk(status, length);
+        });
+}
+
+void FileTransfer::_onChunk(SendStatus status, size_t length){
+    size_t written;
+    bool isFinished = false;
+    {
+        const lock_guard<mutex> lock(_mutex);
+        if(_isDone){
+            return;
+        }
+        if(status == SendStatus::WRITTEN){
+            _written += length;
+            isFinished = _written >= _size;
+        }else{
+            //A disconnected or failing session aborts the transfer
+            isFinished = true;
+        }
+        written = _written;
+        _isDone = isFinished;
+    }
+    if(status == SendStatus::WRITTEN && _onProgress){
+        try{
+            _onProgress(written, _size);
+        }catch(const std::exception& ex){
+            Log::error("FileTransfer: Progress callback has thrown exception");
+        }
+    }
+    if(!isFinished){
+        _sendNext();
+        return;
+    }
+    if(_onComplete){
+        shared_ptr<WebSocketSessionProvider> session = _session.lock();
+        try{
+            _onComplete(status, session ? session->getQueueDepth() : 0);
+        }catch(const std::exception& ex){
+            Log::error("FileTransfer: Completion callback has thrown exception");
+        }
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
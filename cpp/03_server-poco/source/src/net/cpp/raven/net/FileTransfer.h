@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_FILE_TRANSFER_H
+#define RAVEN_NET_FILE_TRANSFER_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Poco/SharedMemory.h"
+
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace net {
+
+//Forward declaration
+class WebSocketSessionProvider;
+
+/**
+ * Streams a memory-mapped file to a web socket session as a sequence of
+ * binary messages. Each message references a chunk of the mapping
+ * directly, so the file content is never copied in user space. Only a
+ * bounded window of chunks is queued at any time. The next chunk is
+ * queued from the completion callback of a written one.
+ * 
+ * A FileTransfer keeps itself alive through the completion callbacks of
+ * its pending messages and does not keep the session alive.
+ */
+class FileTransfer : public std::enable_shared_from_this<FileTransfer> {
+
+    std::weak_ptr<WebSocketSessionProvider> _session;
+    std::shared_ptr<Poco::SharedMemory> _mapping;
+    const char* _data = nullptr;
+    std::size_t _size = 0;
+    std::size_t _chunkSize;
+    const MessagePriority _priority;
+    ProgressCallback _onProgress;
+    SendCallback _onComplete;
+    std::mutex _mutex;
+    std::size_t _queued = 0;
+    std::size_t _written = 0;
+    bool _isDone = false;
+
+public:
+
+    /**
+     * Maps the specified file for a transfer to the specified session.
+     * 
+     * @param session The session to send the file to.
+     * @param path The path of the file to send.
+     * @param priority The priority lane to put the messages into.
+     * @param onProgress The progress callback. May be null.
+     * @param onComplete The completion callback. May be null.
+     * 
+     * @throws runtime_error If the file cannot be mapped.
+     */
+    FileTransfer(
+        std::shared_ptr<WebSocketSessionProvider> session,
+        const std::string& path,
+        MessagePriority priority,
+        ProgressCallback onProgress,
+        SendCallback onComplete);
+
+    /**
+     * Starts this transfer by queuing the first window of chunks.
+     * 
+     * @param window The maximum number of chunks pending at a time.
+     */
+    void start(std::size_t window);
+
+    /**
+     * Returns the size of the transferred file.
+     * 
+     * @return The size of the file in bytes.
+     */
+    std::size_t getSize() const;
+
+private:
+
+    /**
+     * Queues the next chunk of the file, if any.
+     */
+    void _sendNext();
+
+    /**
+     * Handles the completion of the send operation of a chunk.
+     * 
+     * @param status The outcome of the send operation.
+     * @param length The length of the chunk in bytes.
+     */
+    void _onChunk(SendStatus status, std::size_t length);
+
+}; // END CLASS FileTransfer
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_FILE_TRANSFER_H
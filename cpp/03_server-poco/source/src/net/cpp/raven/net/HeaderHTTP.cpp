@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <string_view>
+
+#include "raven/net/HeaderHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::string_view;
+
+//Header names, in the order of the HeaderHTTP constants
+static const string_view HH_NAMES[HEADER_HTTP_COUNT] = {
+    "Accept",
+    "Accept-Encoding",
+    "Accept-Language",
+    "Authorization",
+    "Cache-Control",
+    "Connection",
+    "Content-Encoding",
+    "Content-Length",
+    "Content-Type",
+    "Cookie",
+    "Host",
+    "If-Modified-Since",
+    "If-None-Match",
+    "Origin",
+    "Range",
+    "Referer",
+    "Sec-WebSocket-Key",
+    "Sec-WebSocket-Protocol",
+    "Sec-WebSocket-Version",
+    "Transfer-Encoding",
+    "Upgrade",
+    "User-Agent",
+    "X-Forwarded-For",
+    "X-Request-ID"
+};
+
+static char _toLower(char c){
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+static bool _equalsIgnoreCase(string_view a, string_view b){
+    if(a.size() != b.size()){
+        return false;
+    }
+    for(size_t i = 0; i < a.size(); ++i){
+        if(_toLower(a[i]) != _toLower(b[i])){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parseHeaderHTTP(string_view name, HeaderHTTP& header){
+    for(size_t i = 0; i < HEADER_HTTP_COUNT; ++i){
+        //Most names are rejected by the length check alone
+        if(_equalsIgnoreCase(name, HH_NAMES[i])){
+            header = static_cast<HeaderHTTP>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+string_view toString(HeaderHTTP header){
+    return HH_NAMES[static_cast<size_t>(header)];
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
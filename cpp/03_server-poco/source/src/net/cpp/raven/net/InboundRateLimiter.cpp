@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <initializer_list>
+
+#include "Poco/Net/WebSocket.h"
+
+#include "raven/net/InboundRateLimiter.h"
+#include "raven/net/WebSocketOptions.h"
+#include "raven/net/RateLimitStats.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint64_t;
+using std::atomic;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+using Poco::Net::WebSocket;
+
+atomic<uint64_t> InboundRateLimiter::throttledSessions(0);
+atomic<uint64_t> InboundRateLimiter::pausedMessages(0);
+atomic<uint64_t> InboundRateLimiter::droppedMessages(0);
+atomic<uint64_t> InboundRateLimiter::closedSessions(0);
+
+RateLimitStats RateLimitStats::get(){
+    return RateLimitStats{
+        InboundRateLimiter::throttledSessions.load(),
+        InboundRateLimiter::pausedMessages.load(),
+        InboundRateLimiter::droppedMessages.load(),
+        InboundRateLimiter::closedSessions.load()
+    };
+}
+
+InboundRateLimiter::InboundRateLimiter(const WebSocketOptions& options)
+    :_action(options.rateLimitAction),
+     _lastRefill(steady_clock::now()){
+
+    const double messageRate = std::max(options.inboundMessageRate, 0.0);
+    const double byteRate = std::max(options.inboundByteRate, 0.0);
+    const double messageBurst = (options.inboundMessageBurst > 0)
+        ? double(options.inboundMessageBurst)
+        : std::max(messageRate, 1.0);
+
+    const double byteBurst = (options.inboundByteBurst > 0)
+        ? double(options.inboundByteBurst)
+        : byteRate;
+
+    _messages = Bucket{messageRate, messageBurst, messageBurst};
+    _bytes = Bucket{byteRate, byteBurst, byteBurst};
+}
+
+bool InboundRateLimiter::isEnabled() const{
+    return _messages.rate > 0 || _bytes.rate > 0;
+}
+
+void InboundRateLimiter::_refill(){
+    const steady_clock::time_point now = steady_clock::now();
+    const double elapsed = duration<double>(now - _lastRefill).count();
+    _lastRefill = now;
+    for(Bucket* bucket : {&_messages, &_bytes}){
+        bucket->tokens = std::min(
+            bucket->capacity,
+            bucket->tokens + bucket->rate * elapsed
+        );
+    }
+}
+
+void InboundRateLimiter::_consume(double bytes){
+    if(_messages.rate > 0){
+        _messages.tokens -= 1;
+    }
+    if(_bytes.rate > 0){
+        _bytes.tokens -= bytes;
+    }
+}
+
+void InboundRateLimiter::_markThrottled(){
+    if(!_isThrottled){
+        _isThrottled = true;
+        ++throttledSessions;
+    }
+}
+
+RateLimitDecision InboundRateLimiter::admit(size_t bytes){
+    if(!isEnabled()){
+        return RateLimitDecision::ACCEPT;
+    }
+    _refill();
+    const double size = double(bytes);
+    const bool messageOK = _messages.rate <= 0 || _messages.tokens >= 1;
+    const bool bytesOK = _bytes.rate <= 0 || _bytes.tokens >= size;
+    if(messageOK && bytesOK){
+        _consume(size);
+        return RateLimitDecision::ACCEPT;
+    }
+    _markThrottled();
+    switch(_action){
+    case RateLimitAction::DROP:
+        ++droppedMessages;
+        return RateLimitDecision::DROP;
+    case RateLimitAction::CLOSE:
+        ++closedSessions;
+        return RateLimitDecision::CLOSE;
+    default:
+        break;
+    }
+    //PAUSE: Take the budget on credit and wait until the debt is repaid
+    _consume(size);
+    double wait = 0;
+    for(Bucket* bucket : {&_messages, &_bytes}){
+        if(bucket->rate > 0 && bucket->tokens < 0){
+            wait = std::max(wait, -bucket->tokens / bucket->rate);
+        }
+    }
+    ++pausedMessages;
+    std::this_thread::sleep_for(duration<double>(wait));
+    return RateLimitDecision::ACCEPT;
+}
+
+RateLimitDecision InboundRateLimiter::admit(int flags, size_t bytes){
+    switch(flags & WebSocket::FRAME_OP_BITMASK){
+    case WebSocket::FRAME_OP_CLOSE:
+    case WebSocket::FRAME_OP_PING:
+    case WebSocket::FRAME_OP_PONG:
+        //Control frames must not be delayed or dropped
+        return RateLimitDecision::ACCEPT;
+    default:
+        return admit(bytes);
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_INBOUND_RATE_LIMITER_H
+#define RAVEN_NET_INBOUND_RATE_LIMITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+
+#include "raven/net/WebSocketOptions.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Enumeration for all decisions of an InboundRateLimiter
+ * regarding a received message.
+ */
+enum class RateLimitDecision {
+    ACCEPT,
+    DROP,
+    CLOSE
+};
+
+/**
+ * Token bucket based limiter for the inbound messages of a single
+ * web socket session. Instances of this class are used by the reader
+ * thread of a session only and are therefore not thread-safe.
+ */
+class InboundRateLimiter {
+
+    /**
+     * A token bucket refilled at a constant rate.
+     */
+    struct Bucket {
+        double rate;
+        double capacity;
+        double tokens;
+    };
+
+    Bucket _messages;
+    Bucket _bytes;
+    RateLimitAction _action;
+    std::chrono::steady_clock::time_point _lastRefill;
+    bool _isThrottled = false;
+
+public:
+
+    static std::atomic<std::uint64_t> throttledSessions;
+    static std::atomic<std::uint64_t> pausedMessages;
+    static std::atomic<std::uint64_t> droppedMessages;
+    static std::atomic<std::uint64_t> closedSessions;
+
+    /**
+     * Constructs a new InboundRateLimiter with the limits
+     * configured by the specified WebSocketOptions.
+     * 
+     * @param options The WebSocketOptions of the session.
+     */
+    InboundRateLimiter(const WebSocketOptions& options);
+
+    /**
+     * Indicates whether any limit is configured.
+     * 
+     * @return True if at least one limit is configured, false otherwise.
+     */
+    bool isEnabled() const;
+
+    /**
+     * Decides whether a received message of the specified size is passed
+     * on to the controller. When the limits are exceeded and the PAUSE
+     * action is configured, this method blocks the calling thread until
+     * the budget is available again and then accepts the message.
+     * 
+     * @param bytes The payload size of the received message.
+     * 
+     * @return The decision for the received message.
+     */
+    RateLimitDecision admit(std::size_t bytes);
+
+    /**
+     * Decides whether a received frame with the specified flags and
+     * payload size is passed on to the controller. Control frames, i.e.
+     * close, ping and pong frames, are always accepted and do not take
+     * from the budget of the session. Data frames are admitted
+     * as by admit(std::size_t).
+     * 
+     * @param flags The frame flags as returned by
+     *              Poco::Net::WebSocket::receiveFrame().
+     * @param bytes The payload size of the received frame.
+     * 
+     * @return The decision for the received frame.
+     */
+    RateLimitDecision admit(int flags, std::size_t bytes);
+
+private:
+
+    /**
+     * Refills both token buckets according to the elapsed time.
+     */
+    void _refill();
+
+    /**
+     * Takes the budget for one message of the specified
+     * size from all enabled token buckets.
+     * 
+     * @param bytes The payload size of the message.
+     */
+    void _consume(double bytes);
+
+    /**
+     * Records that the session has exceeded its limits.
+     */
+    void _markThrottled();
+
+}; // END CLASS InboundRateLimiter
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_INBOUND_RATE_LIMITER_H
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
 #include "raven/net/Message.h"
@@ -22,6 +24,8 @@
 namespace raven {
 namespace net {
 
+using std::size_t;
+using std::shared_ptr;
 using std::string;
 
 Message::Message(int type)
@@ -35,14 +39,35 @@ Message::Message(int type, const string& text)
     :_type(type),
      _text(text){ }
 
+Message::Message(int type, string&& text)
+    :_text(std::move(text)),
+     _type(type){ }
+
+Message::Message(int type, shared_ptr<const char> data, size_t size)
+    :_type(type),
+     _data(data),
+     _size(size){ }
+
 const string& Message::getText(){
     return _text;
 }
 
+const char* Message::getData(){
+    return _data ? _data.get() : _text.data();
+}
+
+size_t Message::getSize(){
+    return _data ? _size : _text.size();
+}
+
 bool Message::isText(){
     return _type == 1;
 }
 
+bool Message::isBinary(){
+    return _type == 4;
+}
+
 bool Message::isPing(){
     return _type == 2;
 }
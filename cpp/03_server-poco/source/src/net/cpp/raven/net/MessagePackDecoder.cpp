@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <stdexcept>
+
+#include "raven/net/MessagePackDecoder.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint8_t;
+using std::uint32_t;
+using std::int64_t;
+using std::uint64_t;
+using std::string_view;
+using std::runtime_error;
+
+MessagePackDecoder::MessagePackDecoder(string_view data)
+    :_data(data),
+     _pos(0){ }
+
+bool MessagePackDecoder::hasNext() const{
+    return _pos < _data.size();
+}
+
+size_t MessagePackDecoder::getPosition() const{
+    return _pos;
+}
+
+uint8_t MessagePackDecoder::_peek() const{
+    if(_pos >= _data.size()){
+        throw runtime_error("MessagePack: Unexpected end of data");
+    }
+    return static_cast<uint8_t>(_data[_pos]);
+}
+
+uint64_t MessagePackDecoder::_take(size_t length, size_t start){
+    if(length > _data.size() - _pos){
+        _pos = start;
+        throw runtime_error("MessagePack: Unexpected end of data");
+    }
+    uint64_t value = 0;
+    for(size_t i = 0; i < length; ++i){
+        value = (value << 8) | static_cast<uint8_t>(_data[_pos++]);
+    }
+    return value;
+}
+
+string_view MessagePackDecoder::_view(size_t length, size_t start){
+    if(length > _data.size() - _pos){
+        _pos = start;
+        throw runtime_error("MessagePack: Unexpected end of data");
+    }
+    string_view view = _data.substr(_pos, length);
+    _pos += length;
+    return view;
+}
+
+MessagePackType MessagePackDecoder::peekType() const{
+    const uint8_t marker = _peek();
+    if(marker <= 0x7f || marker >= 0xe0){
+        return MessagePackType::INTEGER;
+    }
+    if(marker <= 0x8f){
+        return MessagePackType::MAP;
+    }
+    if(marker <= 0x9f){
+        return MessagePackType::ARRAY;
+    }
+    if(marker <= 0xbf){
+        return MessagePackType::STRING;
+    }
+    switch(marker){
+        case 0xc0:
+            return MessagePackType::NIL;
+        case 0xc2:
+        case 0xc3:
+            return MessagePackType::BOOLEAN;
+        case 0xc4:
+        case 0xc5:
+        case 0xc6:
+            return MessagePackType::BINARY;
+        case 0xc7:
+        case 0xc8:
+        case 0xc9:
+        case 0xd4:
+        case 0xd5:
+        case 0xd6:
+        case 0xd7:
+        case 0xd8:
+            return MessagePackType::EXTENSION;
+        case 0xca:
+        case 0xcb:
+            return MessagePackType::FLOAT;
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
+            return MessagePackType::STRING;
+        case 0xdc:
+        case 0xdd:
+            return MessagePackType::ARRAY;
+        case 0xde:
+        case 0xdf:
+            return MessagePackType::MAP;
+        default:
+            break;
+    }
+    if(marker >= 0xcc && marker <= 0xd3){
+        return MessagePackType::INTEGER;
+    }
+    throw runtime_error("MessagePack: Invalid marker byte");
+}
+
+void MessagePackDecoder::readNil(){
+    if(_peek() != 0xc0){
+        throw runtime_error("MessagePack: Expected nil");
+    }
+    ++_pos;
+}
+
+bool MessagePackDecoder::readBool(){
+    const uint8_t marker = _peek();
+    if(marker != 0xc2 && marker != 0xc3){
+        throw runtime_error("MessagePack: Expected boolean");
+    }
+    ++_pos;
+    return marker == 0xc3;
+}
+
+uint64_t MessagePackDecoder::_readInteger(bool& isSigned){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    isSigned = false;
+    if(marker <= 0x7f){
+        ++_pos;
+        return marker;
+    }
+    if(marker >= 0xe0){
+        isSigned = true;
+        ++_pos;
+        return static_cast<uint64_t>(static_cast<int64_t>(
+            static_cast<std::int8_t>(marker)));
+    }
+    switch(marker){
+        case 0xcc:
+        case 0xcd:
+        case 0xce:
+        case 0xcf:{
+            ++_pos;
+            return _take(size_t(1) << (marker - 0xcc), start);
+        }
+        case 0xd0:
+        case 0xd1:
+        case 0xd2:
+        case 0xd3:{
+            ++_pos;
+            const size_t length = size_t(1) << (marker - 0xd0);
+            uint64_t value = _take(length, start);
+            //Sign-extend to 64 bits
+            if(length < 8 && (value >> ((length * 8) - 1)) != 0){
+                value |= ~uint64_t(0) << (length * 8);
+            }
+            isSigned = true;
+            return value;
+        }
+        default:
+            throw runtime_error("MessagePack: Expected integer");
+    }
+}
+
+int64_t MessagePackDecoder::readInt(){
+    const size_t start = _pos;
+    bool isSigned;
+    const uint64_t value = _readInteger(isSigned);
+    if(!isSigned && value > static_cast<uint64_t>(INT64_MAX)){
+        _pos = start;
+        throw runtime_error("MessagePack: Integer out of range");
+    }
+    return static_cast<int64_t>(value);
+}
+
+uint64_t MessagePackDecoder::readUInt(){
+    const size_t start = _pos;
+    bool isSigned;
+    const uint64_t value = _readInteger(isSigned);
+    if(isSigned && static_cast<int64_t>(value) < 0){
+        _pos = start;
+        throw runtime_error("MessagePack: Integer out of range");
+    }
+    return value;
+}
+
+double MessagePackDecoder::readDouble(){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    if(marker == 0xca){
+        ++_pos;
+        const uint32_t bits = static_cast<uint32_t>(_take(4, start));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    if(marker == 0xcb){
+        ++_pos;
+        const uint64_t bits = _take(8, start);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    bool isSigned;
+    const uint64_t value = _readInteger(isSigned);
+    if(isSigned){
+        return static_cast<double>(static_cast<int64_t>(value));
+    }
+    return static_cast<double>(value);
+}
+
+string_view MessagePackDecoder::readString(){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    size_t length;
+    if(marker >= 0xa0 && marker <= 0xbf){
+        ++_pos;
+        length = marker & 0x1f;
+    }else if(marker >= 0xd9 && marker <= 0xdb){
+        ++_pos;
+        length = _take(size_t(1) << (marker - 0xd9), start);
+    }else{
+        throw runtime_error("MessagePack: Expected string");
+    }
+    return _view(length, start);
+}
+
+string_view MessagePackDecoder::readBinary(){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    if(marker < 0xc4 || marker > 0xc6){
+        throw runtime_error("MessagePack: Expected binary");
+    }
+    ++_pos;
+    const size_t length = _take(size_t(1) << (marker - 0xc4), start);
+    return _view(length, start);
+}
+
+uint32_t MessagePackDecoder::readArrayHeader(){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    if(marker >= 0x90 && marker <= 0x9f){
+        ++_pos;
+        return marker & 0x0f;
+    }
+    if(marker == 0xdc || marker == 0xdd){
+        ++_pos;
+        return static_cast<uint32_t>(_take(marker == 0xdc ? 2 : 4, start));
+    }
+    throw runtime_error("MessagePack: Expected array");
+}
+
+uint32_t MessagePackDecoder::readMapHeader(){
+    const size_t start = _pos;
+    const uint8_t marker = _peek();
+    if(marker >= 0x80 && marker <= 0x8f){
+        ++_pos;
+        return marker & 0x0f;
+    }
+    if(marker == 0xde || marker == 0xdf){
+        ++_pos;
+        return static_cast<uint32_t>(_take(marker == 0xde ? 2 : 4, start));
+    }
+    throw runtime_error("MessagePack: Expected map");
+}
+
+void MessagePackDecoder::skip(){
+    const size_t start = _pos;
+    //Number of values still to skip, nested containers add their elements
+    uint64_t pending = 1;
+    try{
+        while(pending > 0){
+            --pending;
+            switch(peekType()){
+                case MessagePackType::NIL:
+                    readNil();
+                    break;
+                case MessagePackType::BOOLEAN:
+                    readBool();
+                    break;
+                case MessagePackType::INTEGER:
+                    bool isSigned;
+                    _readInteger(isSigned);
+                    break;
+                case MessagePackType::FLOAT:
+                    readDouble();
+                    break;
+                case MessagePackType::STRING:
+                    readString();
+                    break;
+                case MessagePackType::BINARY:
+                    readBinary();
+                    break;
+                case MessagePackType::ARRAY:
+                    pending += readArrayHeader();
+                    break;
+                case MessagePackType::MAP:
+                    pending += uint64_t(readMapHeader()) * 2;
+                    break;
+                case MessagePackType::EXTENSION:{
+                    const size_t begin = _pos;
+                    const uint8_t marker = _peek();
+                    ++_pos;
+                    size_t length;
+                    if(marker >= 0xd4){
+                        //Fixext 1, 2, 4, 8 or 16
+                        length = size_t(1) << (marker - 0xd4);
+                    }else{
+                        length = _take(size_t(1) << (marker - 0xc7), begin);
+                    }
+                    //Extension type byte followed by the data
+                    _view(length + 1, begin);
+                    break;
+                }
+            }
+        }
+    }catch(const runtime_error&){
+        //Do not leave the position inside a partially skipped container
+        _pos = start;
+        throw;
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
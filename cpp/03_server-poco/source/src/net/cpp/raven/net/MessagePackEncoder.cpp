@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+#include "raven/net/MessagePackEncoder.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint8_t;
+using std::uint32_t;
+using std::int64_t;
+using std::uint64_t;
+using std::string;
+using std::string_view;
+using std::runtime_error;
+
+MessagePackEncoder::MessagePackEncoder(){ }
+
+MessagePackEncoder::MessagePackEncoder(size_t capacity){
+    _buffer.reserve(capacity);
+}
+
+void MessagePackEncoder::_put(uint8_t marker, uint64_t value, size_t length){
+    _buffer.push_back(static_cast<char>(marker));
+    for(size_t i = length; i > 0; --i){
+        _buffer.push_back(static_cast<char>((value >> ((i - 1) * 8)) & 0xff));
+    }
+}
+
+void MessagePackEncoder::writeNil(){
+    _put(0xc0, 0, 0);
+}
+
+void MessagePackEncoder::writeBool(bool value){
+    _put(value ? 0xc3 : 0xc2, 0, 0);
+}
+
+void MessagePackEncoder::writeInt(int64_t value){
+    if(value >= 0){
+        writeUInt(static_cast<uint64_t>(value));
+    }else if(value >= -32){
+        //Negative fixint
+        _put(static_cast<uint8_t>(value), 0, 0);
+    }else if(value >= INT8_MIN){
+        _put(0xd0, static_cast<uint64_t>(value), 1);
+    }else if(value >= INT16_MIN){
+        _put(0xd1, static_cast<uint64_t>(value), 2);
+    }else if(value >= INT32_MIN){
+        _put(0xd2, static_cast<uint64_t>(value), 4);
+    }else{
+        _put(0xd3, static_cast<uint64_t>(value), 8);
+    }
+}
+
+void MessagePackEncoder::writeUInt(uint64_t value){
+    if(value <= 0x7f){
+        //Positive fixint
+        _put(static_cast<uint8_t>(value), 0, 0);
+    }else if(value <= UINT8_MAX){
+        _put(0xcc, value, 1);
+    }else if(value <= UINT16_MAX){
+        _put(0xcd, value, 2);
+    }else if(value <= UINT32_MAX){
+        _put(0xce, value, 4);
+    }else{
+        _put(0xcf, value, 8);
+    }
+}
+
+void MessagePackEncoder::writeFloat(float value){
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    _put(0xca, bits, 4);
+}
+
+void MessagePackEncoder::writeDouble(double value){
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    _put(0xcb, bits, 8);
+}
+
+void MessagePackEncoder::writeString(string_view value){
+    const size_t length = value.size();
+    if(length <= 31){
+        _put(static_cast<uint8_t>(0xa0 | length), 0, 0);
+    }else if(length <= UINT8_MAX){
+        _put(0xd9, length, 1);
+    }else if(length <= UINT16_MAX){
+        _put(0xda, length, 2);
+    }else if(length <= UINT32_MAX){
+        _put(0xdb, length, 4);
+    }else{
+        throw runtime_error("MessagePack: String is too long");
+    }
+    _buffer.append(value.data(), length);
+}
+
+void MessagePackEncoder::writeBinary(string_view value){
+    const size_t length = value.size();
+    if(length <= UINT8_MAX){
+        _put(0xc4, length, 1);
+    }else if(length <= UINT16_MAX){
+        _put(0xc5, length, 2);
+    }else if(length <= UINT32_MAX){
+        _put(0xc6, length, 4);
+    }else{
+        throw runtime_error("MessagePack: Binary value is too long");
+    }
+    _buffer.append(value.data(), length);
+}
+
+void MessagePackEncoder::writeArrayHeader(uint32_t size){
+    if(size <= 15){
+        _put(static_cast<uint8_t>(0x90 | size), 0, 0);
+    }else if(size <= UINT16_MAX){
+        _put(0xdc, size, 2);
+    }else{
+        _put(0xdd, size, 4);
+    }
+}
+
+void MessagePackEncoder::writeMapHeader(uint32_t size){
+    if(size <= 15){
+        _put(static_cast<uint8_t>(0x80 | size), 0, 0);
+    }else if(size <= UINT16_MAX){
+        _put(0xde, size, 2);
+    }else{
+        _put(0xdf, size, 4);
+    }
+}
+
+const string& MessagePackEncoder::getData() const{
+    return _buffer;
+}
+
+size_t MessagePackEncoder::size() const{
+    return _buffer.size();
+}
+
+void MessagePackEncoder::clear(){
+    _buffer.clear();
+}
+
+string MessagePackEncoder::release(){
+    string data = std::move(_buffer);
+    _buffer.clear();
+    return data;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
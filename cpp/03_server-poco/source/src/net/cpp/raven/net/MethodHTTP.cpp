@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <string_view>
+
+#include "raven/net/MethodHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::string_view;
+
+//Method names, in the order of the MethodHTTP constants
+static const string_view MH_NAMES[METHOD_HTTP_COUNT] = {
+    "GET",
+    "HEAD",
+    "POST",
+    "PUT",
+    "DELETE",
+    "PATCH",
+    "OPTIONS",
+    "CONNECT",
+    "TRACE",
+    ""
+};
+
+MethodHTTP parseMethodHTTP(string_view method){
+    //Most requests are GET or POST, so check them first
+    if(method == "GET"){
+        return MethodHTTP::HTTP_GET;
+    }
+    if(method == "POST"){
+        return MethodHTTP::HTTP_POST;
+    }
+    for(size_t i = 0; i < METHOD_HTTP_COUNT - 1; ++i){
+        if(method == MH_NAMES[i]){
+            return static_cast<MethodHTTP>(i);
+        }
+    }
+    return MethodHTTP::HTTP_OTHER;
+}
+
+string_view toString(MethodHTTP method){
+    return MH_NAMES[static_cast<size_t>(method)];
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
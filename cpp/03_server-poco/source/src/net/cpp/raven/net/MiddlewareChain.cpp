@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+
+#include "raven/net/MiddlewareChain.h"
+#include "raven/net/RouterHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+MiddlewareChain::MiddlewareChain(BasicRouterHTTP& router)
+    :_router(router),
+     _next(0){ }
+
+void MiddlewareChain::proceed(RequestHTTP& request, ResponseHTTP& response){
+    if(_next < _router._middleware.size()){
+        const Middleware& middleware = _router._middleware[_next++];
+        middleware(request, response, *this);
+    }else{
+        _router._dispatch(request, response);
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
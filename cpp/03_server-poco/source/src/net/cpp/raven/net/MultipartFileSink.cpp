@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include "Poco/UUIDGenerator.h"
+#include "Poco/Net/NameValueCollection.h"
+
+#include "raven/net/MultipartFileSink.h"
+#include "raven/net/MultipartParser.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::vector;
+using std::ofstream;
+using std::runtime_error;
+using Poco::UUIDGenerator;
+using Poco::Net::NameValueCollection;
+
+MultipartFileSink::MultipartFileSink(const string& directory)
+    :MultipartFileSink(directory, MFS_DEFAULT_MAX_FIELD_SIZE){ }
+
+MultipartFileSink::MultipartFileSink(
+    const string& directory,
+    size_t maxFieldSize)
+    :_directory(directory),
+     _maxFieldSize(maxFieldSize){ }
+
+string MultipartFileSink::_createPath() const{
+    string path = _directory;
+    if(!path.empty() && path.back() != '/'){
+        path += '/';
+    }
+    path += "upload-";
+    path += UUIDGenerator::defaultGenerator().createRandom().toString();
+    return path;
+}
+
+void MultipartFileSink::onPartBegin(const MultipartPart& part){
+    _part = part;
+    _value.clear();
+    if(part.filename.empty()){
+        return;
+    }
+    MultipartFile file;
+    file.part = part;
+    file.path = _createPath();
+    //Register the file before it is created, so that
+    //it is removed if anything goes wrong from here on
+    _files.push_back(file);
+    _out.open(file.path, std::ios::binary | std::ios::trunc);
+    if(!_out){
+        throw runtime_error("Cannot create file '" + file.path + "'");
+    }
+}
+
+void MultipartFileSink::onPartData(string_view data){
+    if(_out.is_open()){
+        //Large writes bypass the stream buffer, the page cache of the
+        //operating system writes them back while the next chunk is received
+        _out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if(!_out){
+            throw runtime_error("Cannot write file '" + _files.back().path + "'");
+        }
+        _files.back().size += data.size();
+        return;
+    }
+    if(_value.size() + data.size() > _maxFieldSize){
+        throw runtime_error(
+            "Form field '" + _part.name + "' exceeds the maximum size");
+    }
+    _value.append(data.data(), data.size());
+}
+
+void MultipartFileSink::onPartEnd(){
+    if(_out.is_open()){
+        _out.close();
+        if(!_out){
+            throw runtime_error("Cannot write file '" + _files.back().path + "'");
+        }
+        return;
+    }
+    _fields.add(_part.name, _value);
+    _value.clear();
+}
+
+void MultipartFileSink::onAbort(){
+    removeFiles();
+}
+
+const vector<MultipartFile>& MultipartFileSink::getFiles() const{
+    return _files;
+}
+
+NameValueCollection& MultipartFileSink::getFields(){
+    return _fields;
+}
+
+void MultipartFileSink::removeFiles(){
+    if(_out.is_open()){
+        _out.close();
+    }
+    for(const MultipartFile& file : _files){
+        std::remove(file.path.c_str());
+    }
+    _files.clear();
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+#include "Poco/Buffer.h"
+
+#include "raven/net/MultipartParser.h"
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/HeaderHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::runtime_error;
+
+static char _toLower(char c){
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+static bool _equalsIgnoreCase(string_view a, string_view b){
+    if(a.size() != b.size()){
+        return false;
+    }
+    for(size_t i = 0; i < a.size(); ++i){
+        if(_toLower(a[i]) != _toLower(b[i])){
+            return false;
+        }
+    }
+    return true;
+}
+
+static string_view _trim(string_view value){
+    size_t begin = 0;
+    size_t end = value.size();
+    while(begin < end && (value[begin] == ' ' || value[begin] == '\t')){
+        ++begin;
+    }
+    while(end > begin && (value[end - 1] == ' ' || value[end - 1] == '\t')){
+        --end;
+    }
+    return value.substr(begin, end - begin);
+}
+
+/**
+ * Finds the parameter with the specified name in the specified header value,
+ * e.g. the 'name' parameter of a Content-Disposition header. Parameter
+ * values may be quoted strings, which can contain semicolons.
+ * 
+ * @param value The header value to search.
+ * @param name The name of the parameter to find. Compared case-insensitively.
+ * @param result The string to assign the value of the parameter to.
+ * 
+ * @return True if the parameter was found, false otherwise.
+ */
+static bool _findParameter(string_view value, string_view name, string& result){
+    size_t i = value.find(';');
+    while(i != string_view::npos){
+        ++i;
+        size_t eq = i;
+        while(eq < value.size() && value[eq] != '=' && value[eq] != ';'){
+            ++eq;
+        }
+        const string_view key = _trim(value.substr(i, eq - i));
+        if(eq >= value.size() || value[eq] == ';'){
+            //Parameter without a value
+            i = (eq < value.size()) ? eq : string_view::npos;
+            continue;
+        }
+        i = eq + 1;
+        while(i < value.size() && (value[i] == ' ' || value[i] == '\t')){
+            ++i;
+        }
+        string parsed;
+        if(i < value.size() && value[i] == '"'){
+            for(++i; i < value.size() && value[i] != '"'; ++i){
+                if(value[i] == '\\' && i + 1 < value.size() && value[i + 1] == '"'){
+                    ++i;
+                }
+                parsed += value[i];
+            }
+            i = value.find(';', i);
+        }else{
+            const size_t end = value.find(';', i);
+            parsed = string(_trim(value.substr(i, end - i)));
+            i = end;
+        }
+        if(_equalsIgnoreCase(key, name)){
+            result = std::move(parsed);
+            return true;
+        }
+    }
+    return false;
+}
+
+MultipartHandler::~MultipartHandler(){ }
+
+void MultipartHandler::onPartBegin(const MultipartPart& part){ }
+
+void MultipartHandler::onPartData(string_view data){ }
+
+void MultipartHandler::onPartEnd(){ }
+
+void MultipartHandler::onAbort(){ }
+
+//The buffer starts with a line break so that a boundary at the
+//very beginning of the body is found like any other delimiter
+MultipartParser::MultipartParser(
+    const string& boundary,
+    MultipartHandler& handler)
+    :_handler(handler),
+     _delimiter("\r\n--" + boundary),
+     _searcher(_delimiter.data(), _delimiter.data() + _delimiter.size()),
+     _buffer("\r\n"){
+
+    if(boundary.empty() || boundary.size() > MP_MAX_BOUNDARY_LENGTH){
+        throw runtime_error("Invalid multipart boundary");
+    }
+}
+
+size_t MultipartParser::_findDelimiter(size_t pos) const{
+    const char* first = _buffer.data() + pos;
+    const char* last = _buffer.data() + _buffer.size();
+    const char* found = std::search(first, last, _searcher);
+    return (found != last) ? static_cast<size_t>(found - _buffer.data())
+                           : string::npos;
+}
+
+void MultipartParser::_parseHeader(string_view line){
+    const size_t colon = line.find(':');
+    if(colon == string_view::npos){
+        throw runtime_error("Malformed multipart body: Invalid part header");
+    }
+    const string_view name = _trim(line.substr(0, colon));
+    const string_view value = _trim(line.substr(colon + 1));
+    if(_equalsIgnoreCase(name, "Content-Disposition")){
+        _findParameter(value, "name", _part.name);
+        _findParameter(value, "filename", _part.filename);
+    }else if(_equalsIgnoreCase(name, "Content-Type")){
+        _part.contentType = string(value);
+    }
+}
+
+void MultipartParser::feed(const char* data, size_t size){
+    if(_state == State::DONE){
+        return;
+    }
+    _buffer.append(data, size);
+    //Data before this position might be the beginning of a delimiter
+    //split across chunks and must be retained until the next chunk
+    const size_t tail = _delimiter.size() - 1;
+    const size_t safe = (_buffer.size() > tail) ? _buffer.size() - tail : 0;
+    size_t pos = 0;
+    bool more = true;
+    while(more){
+        if(_state == State::PREAMBLE){
+            const size_t found = _findDelimiter(pos);
+            if(found != string::npos){
+                pos = found + _delimiter.size();
+                _state = State::DELIMITER;
+            }else{
+                pos = std::max(pos, safe);
+                more = false;
+            }
+        }else if(_state == State::DELIMITER){
+            if(_buffer.size() - pos < 2){
+                more = false;
+            }else if(_buffer.compare(pos, 2, "--") == 0){
+                //Final boundary, the epilogue is ignored
+                _state = State::DONE;
+                pos = _buffer.size();
+                more = false;
+            }else if(_buffer.compare(pos, 2, "\r\n") == 0){
+                pos += 2;
+                _part = MultipartPart();
+                _headerSize = 0;
+                _state = State::HEADERS;
+            }else if(_buffer[pos] == ' ' || _buffer[pos] == '\t'){
+                //Transport padding
+                ++pos;
+            }else{
+                throw runtime_error(
+                    "Malformed multipart body: Invalid boundary delimiter");
+            }
+        }else if(_state == State::HEADERS){
+            const size_t eol = _buffer.find("\r\n", pos);
+            const size_t length = (eol != string::npos)
+                ? eol - pos + 2
+                : _buffer.size() - pos;
+
+            if(_headerSize + length > MP_MAX_HEADER_SIZE){
+                throw runtime_error(
+                    "Malformed multipart body: Part headers are too large");
+            }
+            if(eol == string::npos){
+                more = false;
+            }else{
+                _headerSize += length;
+                if(eol == pos){
+                    _state = State::BODY;
+                    _handler.onPartBegin(_part);
+                }else{
+                    _parseHeader(string_view(_buffer).substr(pos, eol - pos));
+                }
+                pos = eol + 2;
+            }
+        }else if(_state == State::BODY){
+            const size_t found = _findDelimiter(pos);
+            const size_t end = (found != string::npos)
+                ? found
+                : std::max(pos, safe);
+
+            if(end > pos){
+                _handler.onPartData(string_view(_buffer.data() + pos, end - pos));
+            }
+            if(found != string::npos){
+                pos = found + _delimiter.size();
+                _state = State::DELIMITER;
+                _handler.onPartEnd();
+            }else{
+                pos = end;
+                more = false;
+            }
+        }else{
+            more = false;
+        }
+    }
+    _buffer.erase(0, pos);
+}
+
+bool MultipartParser::isDone() const{
+    return _state == State::DONE;
+}
+
+void MultipartParser::finish(){
+    if(_state != State::DONE){
+        throw runtime_error("Malformed multipart body: Unexpected end of body");
+    }
+}
+
+string MultipartParser::getBoundary(string_view contentType){
+    static const string_view prefix = "multipart/";
+    const string_view type = _trim(contentType.substr(0, contentType.find(';')));
+    if(type.size() <= prefix.size()
+        || !_equalsIgnoreCase(type.substr(0, prefix.size()), prefix)){
+
+        return string();
+    }
+    string boundary;
+    _findParameter(contentType, "boundary", boundary);
+    return boundary;
+}
+
+void MultipartParser::parse(RequestHTTP& request, MultipartHandler& handler){
+    const string boundary = getBoundary(
+        request.getHeader(HeaderHTTP::CONTENT_TYPE));
+
+    if(boundary.empty()){
+        throw runtime_error("Request does not have a multipart body");
+    }
+    try{
+        MultipartParser parser(boundary, handler);
+        Poco::Buffer<char> buffer(MP_READ_BUFFER_SIZE);
+        size_t length = 0;
+        //The body is read to its end, even after the final boundary,
+        //so that the connection can be reused for the next request
+        while((length = request.readBody(buffer.begin(), MP_READ_BUFFER_SIZE)) > 0){
+            parser.feed(buffer.begin(), length);
+        }
+        parser.finish();
+    }catch(...){
+        handler.onAbort();
+        throw;
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
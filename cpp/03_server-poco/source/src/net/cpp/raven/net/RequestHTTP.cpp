@@ -14,7 +14,11 @@
  * limitations under the License.
  */
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Poco/Buffer.h"
 #include "Poco/Net/NameValueCollection.h"
@@ -26,7 +30,11 @@
 namespace raven {
 namespace net {
 
+using std::size_t;
+using std::int64_t;
 using std::string;
+using std::string_view;
+using std::vector;
 using Poco::Buffer;
 using Poco::Net::NameValueCollection;
 
@@ -41,10 +49,45 @@ string& RequestHTTP::getURIpath(){
     return _request.getURIpath();
 }
 
+string_view RequestHTTP::getURIpathView(){
+    return _request.getURIpathView();
+}
+
+const vector<PathParam>& RequestHTTP::getPathParams(){
+    return _request.getPathParams();
+}
+
+string_view RequestHTTP::getPathParam(string_view name){
+    for(const PathParam& param : _request.getPathParams()){
+        if(param.name == name){
+            return param.value;
+        }
+    }
+    return string_view();
+}
+
 const string& RequestHTTP::getMethod(){
     return _request.getMethod();
 }
 
+string_view RequestHTTP::getHeader(HeaderHTTP header){
+    const string* value = _request.getHeader(header);
+    return value ? string_view(*value) : string_view();
+}
+
+string_view RequestHTTP::getHeader(string_view name){
+    const string* value = _request.getHeader(name);
+    return value ? string_view(*value) : string_view();
+}
+
+bool RequestHTTP::hasHeader(HeaderHTTP header){
+    return _request.getHeader(header) != nullptr;
+}
+
+MethodHTTP RequestHTTP::getMethodType(){
+    return _request.getMethodType();
+}
+
 NameValueCollection& RequestHTTP::getHeaders(){
     return _request.getHeaders();
 }
@@ -53,14 +96,42 @@ NameValueCollection& RequestHTTP::getQueryParams(){
     return _request.getQueryParams();
 }
 
+string_view RequestHTTP::getQueryParam(string_view name){
+    return _request.getQueryParam(name);
+}
+
+bool RequestHTTP::hasQueryParam(string_view name){
+    return _request.hasQueryParam(name);
+}
+
+string_view RequestHTTP::getCookie(string_view name){
+    return _request.getCookie(name);
+}
+
+bool RequestHTTP::hasCookie(string_view name){
+    return _request.hasCookie(name);
+}
+
+int64_t RequestHTTP::getContentLength(){
+    return _request.getContentLength();
+}
+
 string& RequestHTTP::body(){
     return _request.body();
 }
 
+string_view RequestHTTP::bodyView(){
+    return _request.bodyView();
+}
+
 Buffer<char>& RequestHTTP::bodyRaw(){
     return _request.bodyRaw();
 }
 
+size_t RequestHTTP::readBody(char* buffer, size_t size){
+    return _request.readBody(buffer, size);
+}
+
 bool RequestHTTP::isSecure(){
     return _request.isSecure();
 }
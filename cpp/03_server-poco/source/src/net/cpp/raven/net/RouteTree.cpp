@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+#include "raven/net/RouteTree.h"
+
+
+namespace raven {
+namespace net {
+
+using std::unique_ptr;
+using std::make_unique;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::vector;
+using std::runtime_error;
+
+void RouteTree::insert(const string& pattern, size_t route){
+    if(route == NO_ROUTE){
+        throw runtime_error("Invalid route index");
+    }
+    _insert(_root, pattern, 0, route);
+}
+
+void RouteTree::_insert(
+    Node& node,
+    const string& pattern,
+    size_t pos,
+    size_t route){
+
+    if(pos == pattern.size()){
+        if(node.route != NO_ROUTE){
+            throw runtime_error("Duplicate route: '" + pattern + "'");
+        }
+        node.route = route;
+        return;
+    }
+    const bool segmentStart = (pos == 0) || (pattern[pos - 1] == '/');
+    if(pattern[pos] == '{'){
+        const size_t close = pattern.find('}', pos);
+        if(!segmentStart || close == string::npos || close == pos + 1
+            || (close + 1 < pattern.size() && pattern[close + 1] != '/')){
+
+            throw runtime_error("Invalid parameter in route: '" + pattern + "'");
+        }
+        const string name = pattern.substr(pos + 1, close - pos - 1);
+        if(!node.param){
+            node.param = make_unique<Node>();
+            node.param->label = name;
+        }else if(node.param->label != name){
+            throw runtime_error(
+                "Conflicting parameter names in route: '" + pattern + "'");
+        }
+        _insert(*node.param, pattern, close + 1, route);
+        return;
+    }
+    if(pattern[pos] == '*'){
+        const string name = pattern.substr(pos + 1);
+        if(!segmentStart || name.find_first_of("/{*") != string::npos){
+            throw runtime_error("Invalid wildcard in route: '" + pattern + "'");
+        }
+        if(!node.wildcard){
+            node.wildcard = make_unique<Node>();
+            node.wildcard->label = name.empty() ? "*" : name;
+        }
+        _insert(*node.wildcard, pattern, pattern.size(), route);
+        return;
+    }
+    size_t end = pattern.find_first_of("{*", pos);
+    if(end == string::npos){
+        end = pattern.size();
+    }
+    _insertStatic(node, pattern, pos, end, route);
+}
+
+void RouteTree::_insertStatic(
+    Node& node,
+    const string& pattern,
+    size_t pos,
+    size_t end,
+    size_t route){
+
+    for(unique_ptr<Node>& child : node.children){
+        if(child->label[0] != pattern[pos]){
+            continue;
+        }
+        //Children have distinct first characters, so this is the only
+        //candidate. Determine the length of the common prefix
+        const string& label = child->label;
+        size_t n = 0;
+        while(n < label.size() && pos + n < end && label[n] == pattern[pos + n]){
+            ++n;
+        }
+        if(n < label.size()){
+            //Split the edge at the end of the common prefix
+            unique_ptr<Node> split = make_unique<Node>();
+            split->label = label.substr(0, n);
+            child->label.erase(0, n);
+            split->children.push_back(std::move(child));
+            child = std::move(split);
+        }
+        _insert(*child, pattern, pos + n, route);
+        return;
+    }
+    unique_ptr<Node> child = make_unique<Node>();
+    child->label = pattern.substr(pos, end - pos);
+    node.children.push_back(std::move(child));
+    _insert(*node.children.back(), pattern, end, route);
+}
+
+size_t RouteTree::find(string_view path, vector<PathParam>& params) const{
+    return _find(_root, path, 0, params);
+}
+
+size_t RouteTree::_find(
+    const Node& node,
+    string_view path,
+    size_t pos,
+    vector<PathParam>& params){
+
+    if(pos == path.size() && node.route != NO_ROUTE){
+        return node.route;
+    }
+    if(pos < path.size()){
+        //Static segments have the highest priority
+        for(const unique_ptr<Node>& child : node.children){
+            const string& label = child->label;
+            if(label[0] == path[pos]
+                && path.compare(pos, label.size(), label) == 0){
+
+                const size_t route = _find(*child, path, pos + label.size(), params);
+                if(route != NO_ROUTE){
+                    return route;
+                }
+                break;
+            }
+        }
+        if(node.param){
+            size_t end = path.find('/', pos);
+            if(end == string_view::npos){
+                end = path.size();
+            }
+            if(end > pos){
+                params.push_back(PathParam{
+                    node.param->label,
+                    path.substr(pos, end - pos)
+                });
+                const size_t route = _find(*node.param, path, end, params);
+                if(route != NO_ROUTE){
+                    return route;
+                }
+                params.pop_back();
+            }
+        }
+    }
+    if(node.wildcard){
+        params.push_back(PathParam{node.wildcard->label, path.substr(pos)});
+        return node.wildcard->route;
+    }
+    return NO_ROUTE;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_ROUTE_TREE_H
+#define RAVEN_NET_ROUTE_TREE_H
+
+#include <memory>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "raven/net/RequestHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * A compressed radix tree which maps URI path patterns to route indices.
+ * 
+ * A pattern is a URI path which may contain the following elements:
+ *   {name}  A named parameter which matches one non-empty path segment.
+ *           It must span an entire segment, e.g. '/users/{id}/orders'.
+ *   *name   A named wildcard which matches the remainder of the path,
+ *           including any slashes. It must be the last segment of the
+ *           pattern, e.g. '*path' following '/files/'. The name may be
+ *           omitted, in which case the parameter is named '*'.
+ * 
+ * When a path is matched, static segments take priority over parameters,
+ * which in turn take priority over wildcards. A path is only matched by
+ * a parameter or wildcard if it is not matched by a more specific pattern.
+ * 
+ * A RouteTree is built once and is then only read, so concurrent
+ * calls to find() are safe.
+ */
+class RouteTree {
+
+    struct Node {
+        //The static text consumed when entering this node, or the
+        //parameter name if this is a parameter or wildcard node
+        std::string label;
+        std::vector<std::unique_ptr<Node>> children;
+        std::unique_ptr<Node> param;
+        std::unique_ptr<Node> wildcard;
+        std::size_t route = NO_ROUTE;
+    };
+
+    Node _root;
+
+public:
+
+    //Indicates that no route matches a path
+    static constexpr std::size_t NO_ROUTE = static_cast<std::size_t>(-1);
+
+    RouteTree() = default;
+
+    RouteTree(RouteTree const&) = delete;
+
+    void operator=(RouteTree const&) = delete;
+
+    /**
+     * Adds a route for the specified pattern.
+     * 
+     * @param pattern The URI path pattern of the route.
+     * @param route The index of the route. Must not be NO_ROUTE.
+     * 
+     * @throws runtime_error If the pattern is malformed or conflicts
+     *                       with a pattern which was added before.
+     */
+    void insert(const std::string& pattern, std::size_t route);
+
+    /**
+     * Finds the route matching the specified URI path. The views of the
+     * captured parameters point into the specified path and into this tree.
+     * 
+     * @param path The URI path to match.
+     * @param params The list to append the captured parameters to.
+     *               Parameters of partial matches are removed again.
+     * 
+     * @return The index of the matching route, or NO_ROUTE if
+     *         no route matches the specified path.
+     */
+    std::size_t find(std::string_view path, std::vector<PathParam>& params) const;
+
+private:
+
+    void _insertStatic(
+        Node& node,
+        const std::string& pattern,
+        std::size_t pos,
+        std::size_t end,
+        std::size_t route);
+
+    void _insert(
+        Node& node,
+        const std::string& pattern,
+        std::size_t pos,
+        std::size_t route);
+
+    static std::size_t _find(
+        const Node& node,
+        std::string_view path,
+        std::size_t pos,
+        std::vector<PathParam>& params);
+
+}; // END CLASS RouteTree
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_ROUTE_TREE_H
@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <future>
+#include <exception>
+#include <stdexcept>
+#include <typeinfo>
+
+#include "Poco/Exception.h"
+#include "Poco/Dynamic/Var.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Parser.h"
+
+#include "raven/net/RpcController.h"
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/util/WorkerPool.h"
+#include "raven/util/Log.h"
+
+
+namespace raven {
+namespace net {
+
+using std::shared_ptr;
+using std::size_t;
+using std::uint64_t;
+using std::string;
+using std::ostringstream;
+using std::unique_lock;
+using std::mutex;
+using std::thread;
+using std::promise;
+using std::future;
+using std::exception_ptr;
+using std::make_exception_ptr;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+using Poco::Dynamic::Var;
+using Poco::JSON::Object;
+using Poco::JSON::Parser;
+using raven::util::WorkerPool;
+using raven::util::Log;
+
+//The default maximum number of in-flight calls from a single session
+static const size_t RPC_MAX_IN_FLIGHT = 64;
+
+static string _toJSON(const Object& obj){
+    ostringstream os;
+    obj.stringify(os);
+    return os.str();
+}
+
+static string _resultResponse(const Var& id, const Var& result){
+    Object response;
+    response.set("jsonrpc", "2.0");
+    response.set("id", id);
+    response.set("result", result);
+    return _toJSON(response);
+}
+
+static string _errorResponse(const Var& id, int code, const string& message){
+    Object::Ptr error = new Object();
+    error->set("code", code);
+    error->set("message", message);
+    Object response;
+    response.set("jsonrpc", "2.0");
+    response.set("id", id);
+    response.set("error", error);
+    return _toJSON(response);
+}
+
+static RpcException _responseError(const Var& error){
+    try{
+        if(error.type() == typeid(Object::Ptr)){
+            Object::Ptr obj = error.extract<Object::Ptr>();
+            const Var code = obj->get("code");
+            const Var message = obj->get("message");
+            if(code.isInteger() && message.isString()){
+                return RpcException(
+                    code.convert<int>(), message.convert<string>());
+            }
+        }
+    }catch(const Poco::Exception& ex){
+        //Code out of range
+    }
+    return RpcException(RpcException::INTERNAL_ERROR, "Invalid error response");
+}
+
+RpcException::RpcException(int code, const string& message)
+    :std::runtime_error(message),
+     _code(code){ }
+
+int RpcException::getCode() const{
+    return _code;
+}
+
+RpcController::RpcController()
+    :RpcController(0){ }
+
+RpcController::RpcController(size_t numWorkers)
+    :RpcController(numWorkers, RPC_MAX_IN_FLIGHT){ }
+
+RpcController::RpcController(size_t numWorkers, size_t maxInFlight)
+    :_maxInFlight(maxInFlight),
+     _nextCallID(1),
+     _workers(new WorkerPool(numWorkers)){
+
+    _reaper = thread(&RpcController::_reaperLoop, this);
+}
+
+RpcController::~RpcController(){
+    _workers->stop();
+    {
+        unique_lock<mutex> lock(_mutex);
+        _isRunning = false;
+    }
+    _condition.notify_all();
+    _reaper.join();
+}
+
+void RpcController::registerMethod(const string& method, RpcHandler handler){
+    _handlers[method] = handler;
+}
+
+future<Var> RpcController::call(
+    Session& session,
+    const string& method,
+    const Var& params,
+    milliseconds timeout){
+
+    const uint64_t id = _nextCallID++;
+    future<Var> result;
+    {
+        unique_lock<mutex> lock(_mutex);
+        PendingCall& call = _calls[id];
+        call.sessionID = session.getID();
+        call.deadline = steady_clock::now() + timeout;
+        result = call.result.get_future();
+    }
+    //Wake up the reaper so that it considers the new deadline
+    _condition.notify_all();
+
+    Object request;
+    request.set("jsonrpc", "2.0");
+    request.set("id", id);
+    request.set("method", method);
+    if(!params.isEmpty()){
+        request.set("params", params);
+    }
+    session.send(
+        _toJSON(request),
+        MessagePriority::INTERACTIVE,
+        [this, id](SendStatus status, size_t){
+            if(status == SendStatus::DROPPED || status == SendStatus::FAILED){
+                _complete(id, Var(), make_exception_ptr(RpcException(
+                    RpcException::SESSION_CLOSED, "Session closed")));
+            }
+        });
+
+    return result;
+}
+
+void RpcController::notify(
+    Session& session,
+    const string& method,
+    const Var& params){
+
+    Object request;
+    request.set("jsonrpc", "2.0");
+    request.set("method", method);
+    if(!params.isEmpty()){
+        request.set("params", params);
+    }
+    session.send(_toJSON(request));
+}
+
+void RpcController::onDisconnect(Session& session){
+    const string sid = session.getID();
+    unique_lock<mutex> lock(_mutex);
+    for(auto it = _calls.begin(); it != _calls.end();){
+        if(it->second.sessionID == sid){
+            it->second.result.set_exception(make_exception_ptr(RpcException(
+                RpcException::SESSION_CLOSED, "Session closed")));
+            it = _calls.erase(it);
+        }else{
+            ++it;
+        }
+    }
+}
+
+void RpcController::onMessageReceived(Session& session, Message& message){
+    Var json;
+    try{
+        Parser parser;
+        json = parser.parse(message.getText());
+    }catch(const Poco::Exception& ex){
+        session.send(_errorResponse(
+            Var(), RpcException::PARSE_ERROR, "Parse error"));
+        return;
+    }
+    if(json.type() != typeid(Object::Ptr)){
+        //Valid JSON, but not a request object. Batches are not supported
+        session.send(_errorResponse(
+            Var(), RpcException::INVALID_REQUEST, "Invalid Request"));
+        return;
+    }
+    Object::Ptr obj = json.extract<Object::Ptr>();
+    try{
+        if(obj->has("method")){
+            //Request or notification from the client
+            const Var id = obj->get("id");
+            const string method = obj->getValue<string>("method");
+            const Var params = obj->get("params");
+            if(!_acquire(session.getID())){
+                //Notifications are never answered
+                if(!id.isEmpty()){
+                    session.send(_errorResponse(
+                        id, RpcException::SERVER_BUSY, "Server busy"));
+                }
+                return;
+            }
+            //Keep the Session alive while the call is executed
+            shared_ptr<Session> sp = session.shared_from_this();
+            _workers->submit([this, sp, id, method, params]{
+                _execute(sp, id, method, params);
+            });
+        }else if(obj->has("id") && obj->get("id").isInteger()){
+            //Response to a call made by the server
+            _receiveResponse(*obj);
+        }else{
+            session.send(_errorResponse(
+                obj->get("id"),
+                RpcException::INVALID_REQUEST,
+                "Invalid Request"));
+        }
+    }catch(const Poco::Exception& ex){
+        session.send(_errorResponse(
+            Var(), RpcException::INVALID_REQUEST, "Invalid Request"));
+    }
+}
+
+void RpcController::_receiveResponse(const Object& response){
+    uint64_t id = 0;
+    try{
+        id = response.get("id").convert<uint64_t>();
+    }catch(const Poco::Exception& ex){
+        //Negative IDs are never used for calls
+        return;
+    }
+    if(response.has("error")){
+        _complete(id, Var(), make_exception_ptr(
+            _responseError(response.get("error"))));
+    }else{
+        _complete(id, response.get("result"), nullptr);
+    }
+}
+
+bool RpcController::_acquire(const string& sessionID){
+    unique_lock<mutex> lock(_mutex);
+    size_t& count = _inFlight[sessionID];
+    if(count >= _maxInFlight){
+        if(count == 0){
+            _inFlight.erase(sessionID);
+        }
+        return false;
+    }
+    ++count;
+    return true;
+}
+
+void RpcController::_release(const string& sessionID){
+    unique_lock<mutex> lock(_mutex);
+    auto item = _inFlight.find(sessionID);
+    if(item != _inFlight.end() && --item->second == 0){
+        _inFlight.erase(item);
+    }
+}
+
+void RpcController::_execute(
+    shared_ptr<Session> session,
+    const Var& id,
+    const string& method,
+    const Var& params){
+
+    string response;
+    auto handler = _handlers.find(method);
+    if(handler == _handlers.end()){
+        response = _errorResponse(
+            id, RpcException::METHOD_NOT_FOUND, "Method not found");
+    }else{
+        try{
+            response = _resultResponse(id, handler->second(*session, params));
+        }catch(const RpcException& ex){
+            response = _errorResponse(id, ex.getCode(), ex.what());
+        }catch(const std::exception& ex){
+            Log::error(
+                "RpcController: Handler of method '" + method
+                + "' has thrown uncaught exception");
+
+            response = _errorResponse(
+                id, RpcException::INTERNAL_ERROR, "Internal error");
+        }
+    }
+    //Released before responding, so that the client can call again
+    _release(session->getID());
+    //Notifications are never answered
+    if(!id.isEmpty()){
+        session->send(response);
+    }
+}
+
+void RpcController::_complete(
+    uint64_t id,
+    const Var& result,
+    exception_ptr error){
+
+    promise<Var> call;
+    {
+        unique_lock<mutex> lock(_mutex);
+        auto item = _calls.find(id);
+        if(item == _calls.end()){
+            //Unknown, timed out or already completed
+            return;
+        }
+        call = std::move(item->second.result);
+        _calls.erase(item);
+    }
+    if(error){
+        call.set_exception(error);
+    }else{
+        call.set_value(result);
+    }
+}
+
+void RpcController::_reaperLoop(){
+    unique_lock<mutex> lock(_mutex);
+    while(_isRunning){
+        if(_calls.empty()){
+            _condition.wait(lock);
+        }else{
+            steady_clock::time_point earliest = steady_clock::time_point::max();
+            for(const auto& item : _calls){
+                if(item.second.deadline < earliest){
+                    earliest = item.second.deadline;
+                }
+            }
+            _condition.wait_until(lock, earliest);
+        }
+        const steady_clock::time_point now = steady_clock::now();
+        for(auto it = _calls.begin(); it != _calls.end();){
+            if(it->second.deadline <= now){
+                it->second.result.set_exception(make_exception_ptr(
+                    RpcException(RpcException::TIMEOUT, "Call timed out")));
+
+                it = _calls.erase(it);
+            }else{
+                ++it;
+            }
+        }
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
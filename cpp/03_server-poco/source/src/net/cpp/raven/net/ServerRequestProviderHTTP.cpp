@@ -14,11 +14,19 @@
  * limitations under the License.
  */
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <istream>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 
 #include "Poco/Buffer.h"
-#include "Poco/StringTokenizer.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/NameValueCollection.h"
 
@@ -31,13 +39,17 @@ namespace net {
 
 using std::istream;
 using std::size_t;
+using std::int64_t;
+using std::runtime_error;
 using std::string;
+using std::string_view;
+using std::vector;
 using Poco::Buffer;
-using Poco::StringTokenizer;
 using Poco::Net::HTTPServerRequest;
 using Poco::Net::NameValueCollection;
 
-static const size_t PAYLOAD_TMP_BUFFER_SIZE = 8192;
+static const size_t PAYLOAD_INITIAL_BUFFER_SIZE = 8192;
+static const size_t PAYLOAD_MAX_INITIAL_BUFFER_SIZE = 65536;
 
 ServerRequestProviderHTTP::ServerRequestProviderHTTP(
     HTTPServerRequest& request)
@@ -45,110 +57,426 @@ ServerRequestProviderHTTP::ServerRequestProviderHTTP(
       _body(Buffer<char>(0)){ }
 
 
-void ServerRequestProviderHTTP::_readPayload(){
-    istream& is = _request.stream();
+static char* _dataOf(Buffer<char>& storage){
+    return storage.begin();
+}
 
-    if(_body.capacity() == 0){
-        _body.setCapacity(PAYLOAD_TMP_BUFFER_SIZE);
-    }
-    Buffer<char> buffer(0);
-    buffer.setCapacity(PAYLOAD_TMP_BUFFER_SIZE);
-    std::streamsize len = 0;
-    is.read(buffer.begin(), PAYLOAD_TMP_BUFFER_SIZE);
-    std::streamsize n = is.gcount();
-    while(n > 0){
-        buffer.resize(n);
-        len += n;
-        _body.append(buffer);
-        if(is){
-            is.read(buffer.begin(), PAYLOAD_TMP_BUFFER_SIZE);
-            n = is.gcount();
-        }else{
-            n = 0;
+static char* _dataOf(string& storage){
+    return &storage[0];
+}
+
+static void _resize(Buffer<char>& storage, size_t size){
+    storage.resize(size, true);
+}
+
+static void _resize(string& storage, size_t size){
+    storage.resize(size);
+}
+
+template<typename Storage>
+void ServerRequestProviderHTTP::_readPayload(Storage& storage){
+    if(_bodyStreamed){
+        throw runtime_error("Request body has already been consumed");
+    }
+    const int64_t length = getContentLength();
+    if(_maxBodySize > 0 && length > static_cast<int64_t>(_maxBodySize)){
+        throw PayloadTooLargeException();
+    }
+    //Read directly into the storage. The declared length is only trusted
+    //up to the route limit. Without a limit, the initial allocation is
+    //capped and the storage grows geometrically as the bytes arrive
+    size_t capacity = PAYLOAD_INITIAL_BUFFER_SIZE;
+    if(length >= 0){
+        capacity = static_cast<size_t>(length);
+        if(_maxBodySize == 0){
+            capacity = std::min(capacity, PAYLOAD_MAX_INITIAL_BUFFER_SIZE);
+        }
+    }
+    if(_maxBodySize > 0 && capacity > _maxBodySize){
+        //One more byte than allowed to detect an exceeding body
+        capacity = _maxBodySize + 1;
+    }
+    _resize(storage, capacity);
+    istream& is = _request.stream();
+    size_t size = 0;
+    while(is){
+        if(size == capacity){
+            if(length >= 0 && size >= static_cast<size_t>(length)){
+                break;
+            }
+            if(_maxBodySize > 0 && size > _maxBodySize){
+                throw PayloadTooLargeException();
+            }
+            capacity = (size > 0) ? (2 * size) : PAYLOAD_INITIAL_BUFFER_SIZE;
+            if(length >= 0 && capacity > static_cast<size_t>(length)){
+                capacity = static_cast<size_t>(length);
+            }
+            if(_maxBodySize > 0 && capacity > _maxBodySize){
+                capacity = _maxBodySize + 1;
+            }
+            _resize(storage, capacity);
         }
+        is.read(_dataOf(storage) + size, capacity - size);
+        size += static_cast<size_t>(is.gcount());
+    }
+    if(_maxBodySize > 0 && size > _maxBodySize){
+        throw PayloadTooLargeException();
     }
-    _body.resize(len);
-    _bodyReady = true;
+    _resize(storage, size);
 }
 
 const string& ServerRequestProviderHTTP::getURI(){
     return _request.getURI();
 }
 
-string& ServerRequestProviderHTTP::getURIpath(){
-    if(!_uriPathReady){
-        const string& uri = _request.getURI();
-        string path = uri;
-        auto pos = path.find("?");
-        if(pos != string::npos){
-            path = path.substr(0, pos);
+static int _hexValue(char c){
+    if(c >= '0' && c <= '9'){
+        return c - '0';
+    }
+    if(c >= 'a' && c <= 'f'){
+        return c - 'a' + 10;
+    }
+    if(c >= 'A' && c <= 'F'){
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * Decodes the next character of the specified percent-encoded query
+ * component, starting at the specified position, which is advanced
+ * past the encoded character. Malformed escapes are taken literally.
+ */
+static char _decodeNext(string_view text, size_t& pos){
+    const char c = text[pos++];
+    if(c == '+'){
+        return ' ';
+    }
+    if(c == '%' && pos + 1 < text.size()){
+        const int high = _hexValue(text[pos]);
+        const int low = _hexValue(text[pos + 1]);
+        if(high >= 0 && low >= 0){
+            pos += 2;
+            return static_cast<char>((high << 4) | low);
+        }
+    }
+    return c;
+}
+
+static bool _isEncoded(string_view text){
+    return text.find_first_of("%+") != string_view::npos;
+}
+
+/**
+ * Compares the specified percent-encoded query component with the
+ * specified plain text, without decoding it into a new string.
+ */
+static bool _decodedEquals(string_view encoded, string_view text){
+    if(!_isEncoded(encoded)){
+        return encoded == text;
+    }
+    size_t pos = 0;
+    size_t i = 0;
+    while(pos < encoded.size()){
+        if(i == text.size() || _decodeNext(encoded, pos) != text[i++]){
+            return false;
+        }
+    }
+    return i == text.size();
+}
+
+static string_view _trim(string_view text){
+    const size_t begin = text.find_first_not_of(" \t\r\n");
+    if(begin == string_view::npos){
+        return string_view();
+    }
+    const size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+void ServerRequestProviderHTTP::_parseURI(){
+    //Slice the URI in a single pass, the views point into the URI
+    //string of the underlying request which outlives this object
+    const string_view uri(_request.getURI());
+    size_t end = uri.find_first_of("?#");
+    _uriPathView = uri.substr(0, end);
+    if(end != string_view::npos && uri[end] == '?'){
+        size_t pos = end + 1;
+        end = uri.find('#', pos);
+        if(end == string_view::npos){
+            end = uri.size();
         }
-        pos = path.find("#");
-        if(pos != string::npos){
-            path = path.substr(0, pos);
+        while(pos < end){
+            size_t next = uri.find('&', pos);
+            if(next == string_view::npos || next > end){
+                next = end;
+            }
+            //Tokens are trimmed and parameters without a value are
+            //ignored, like in the collection of getQueryParams()
+            const string_view token = _trim(uri.substr(pos, next - pos));
+            const size_t eq = token.find('=');
+            if(eq != string_view::npos && token.size() > eq + 1){
+                _queryEntries.push_back(QueryEntry{
+                    token.substr(0, eq),
+                    token.substr(eq + 1),
+                    string_view(),
+                    false
+                });
+            }
+            pos = next + 1;
         }
-        _uriPath = path;
+    }
+    _uriParsed = true;
+}
+
+string& ServerRequestProviderHTTP::getURIpath(){
+    if(!_uriPathReady){
+        _uriPath = string(getURIpathView());
         _uriPathReady = true;
     }
     return _uriPath;
 }
 
+string_view ServerRequestProviderHTTP::getURIpathView(){
+    if(!_uriParsed){
+        _parseURI();
+    }
+    return _uriPathView;
+}
+
+ServerRequestProviderHTTP::QueryEntry*
+ServerRequestProviderHTTP::_findQueryEntry(string_view name){
+    if(!_uriParsed){
+        _parseURI();
+    }
+    for(QueryEntry& entry : _queryEntries){
+        if(_decodedEquals(entry.name, name)){
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+string_view ServerRequestProviderHTTP::getQueryParam(string_view name){
+    QueryEntry* entry = _findQueryEntry(name);
+    if(!entry){
+        return string_view();
+    }
+    if(!entry->isDecoded){
+        //Only decode values which are actually read
+        entry->decoded = entry->value;
+        if(_isEncoded(entry->value)){
+            string value;
+            value.reserve(entry->value.size());
+            size_t pos = 0;
+            while(pos < entry->value.size()){
+                value += _decodeNext(entry->value, pos);
+            }
+            _decoded.push_back(std::move(value));
+            entry->decoded = _decoded.back();
+        }
+        entry->isDecoded = true;
+    }
+    return entry->decoded;
+}
+
+bool ServerRequestProviderHTTP::hasQueryParam(string_view name){
+    return _findQueryEntry(name) != nullptr;
+}
+
+vector<PathParam>& ServerRequestProviderHTTP::getPathParams(){
+    return _pathParams;
+}
+
 const string& ServerRequestProviderHTTP::getMethod(){
     return _request.getMethod();
 }
 
+MethodHTTP ServerRequestProviderHTTP::getMethodType(){
+    if(!_methodReady){
+        _method = parseMethodHTTP(_request.getMethod());
+        _methodReady = true;
+    }
+    return _method;
+}
+
 NameValueCollection& ServerRequestProviderHTTP::getHeaders(){
+    //The caller may keep the collection and modify it at any time,
+    //so neither the index nor the cookie slices can be trusted anymore
+    _headersExposed = true;
     return _request;
 }
 
+void ServerRequestProviderHTTP::_indexHeaders(){
+    std::fill(std::begin(_headerIndex), std::end(_headerIndex), nullptr);
+    const NameValueCollection& headers = _request;
+    for(auto it = headers.begin(); it != headers.end(); ++it){
+        HeaderHTTP header;
+        if(parseHeaderHTTP(it->first, header)){
+            const string*& value = _headerIndex[static_cast<size_t>(header)];
+            if(!value){
+                value = &it->second;
+            }
+        }
+    }
+    _headersIndexed = true;
+}
+
+const string* ServerRequestProviderHTTP::_findHeader(string_view name){
+    const NameValueCollection& headers = _request;
+    auto item = headers.find(string(name));
+    return (item != headers.end()) ? &item->second : nullptr;
+}
+
+const string* ServerRequestProviderHTTP::getHeader(HeaderHTTP header){
+    if(_headersExposed){
+        return _findHeader(toString(header));
+    }
+    if(!_headersIndexed){
+        _indexHeaders();
+    }
+    return _headerIndex[static_cast<size_t>(header)];
+}
+
+const string* ServerRequestProviderHTTP::getHeader(string_view name){
+    HeaderHTTP header;
+    if(parseHeaderHTTP(name, header)){
+        return getHeader(header);
+    }
+    return _findHeader(name);
+}
+
 NameValueCollection& ServerRequestProviderHTTP::getQueryParams(){
     if(!_queryParamsReady){
-        const string& uri = _request.getURI();
-        string query = uri;
-        auto pos = query.find("#");
-        if(pos != string::npos){
-            query = query.substr(0, pos);
-        }
-        pos = query.find("?");
-        NameValueCollection params;
-        if((pos != string::npos) && (query.size() > (pos + 1))){
-            query = query.substr(pos + 1);
-
-            StringTokenizer tokens(query, "&",
-                StringTokenizer::TOK_TRIM | StringTokenizer::TOK_IGNORE_EMPTY);
-
-            for(const string& token : tokens){
-                auto index = token.find("=");
-                if(index != string::npos && (token.size() > (index + 1))){
-                    string key = token.substr(0, index);
-                    string val = token.substr(index + 1);
-                    params.add(key, val);
-                }
-            }
+        if(!_uriParsed){
+            _parseURI();
+        }
+        //The collection holds the names and values as they appear in the URI
+        for(const QueryEntry& entry : _queryEntries){
+            _queryParams.add(string(entry.name), string(entry.value));
         }
-        _queryParams = params;
         _queryParamsReady = true;
     }
     return _queryParams;
 }
 
-string& ServerRequestProviderHTTP::body(){
-    if(!_bodyReady){
-        _readPayload();
+void ServerRequestProviderHTTP::_parseCookies(){
+    //Slice the header value in a single pass, pairs are separated
+    //by semicolons and pairs without a name or value sign are ignored
+    _cookies.clear();
+    const string* header = getHeader(HeaderHTTP::COOKIE);
+    if(header){
+        const string_view text(*header);
+        size_t pos = 0;
+        while(pos < text.size()){
+            size_t next = text.find(';', pos);
+            if(next == string_view::npos){
+                next = text.size();
+            }
+            const string_view pair = text.substr(pos, next - pos);
+            const size_t eq = pair.find('=');
+            if(eq != string_view::npos){
+                const string_view name = _trim(pair.substr(0, eq));
+                string_view value = _trim(pair.substr(eq + 1));
+                if(value.size() >= 2 && value.front() == '"' && value.back() == '"'){
+                    value = value.substr(1, value.size() - 2);
+                }
+                if(!name.empty()){
+                    _cookies.push_back(CookieEntry{name, value});
+                }
+            }
+            pos = next + 1;
+        }
     }
-    if(_body.empty()){
-        return _bodyStr;
+    _cookiesParsed = true;
+}
+
+const ServerRequestProviderHTTP::CookieEntry*
+ServerRequestProviderHTTP::_findCookie(string_view name){
+    //Slices of a Cookie header modified through getHeaders()
+    //might point to released memory, so they are rebuilt
+    if(!_cookiesParsed || _headersExposed){
+        _parseCookies();
+    }
+    for(const CookieEntry& entry : _cookies){
+        if(entry.name == name){
+            return &entry;
+        }
     }
-    if(_bodyStr.empty()){
-        //With C++17: Use std::string_view to avoid copy?
-        _bodyStr = string(_body.begin(), _body.size());
+    return nullptr;
+}
+
+string_view ServerRequestProviderHTTP::getCookie(string_view name){
+    const CookieEntry* entry = _findCookie(name);
+    return entry ? entry->value : string_view();
+}
+
+bool ServerRequestProviderHTTP::hasCookie(string_view name){
+    return _findCookie(name) != nullptr;
+}
+
+int64_t ServerRequestProviderHTTP::getContentLength(){
+    return _request.getContentLength64();
+}
+
+void ServerRequestProviderHTTP::setMaxBodySize(size_t size){
+    _maxBodySize = size;
+}
+
+size_t ServerRequestProviderHTTP::readBody(char* buffer, size_t size){
+    if(_bodyReady || _bodyStrReady){
+        const string_view body = bodyView();
+        const size_t n = std::min(size, body.size() - _bodyConsumed);
+        if(n > 0){
+            std::memcpy(buffer, body.data() + _bodyConsumed, n);
+            _bodyConsumed += n;
+        }
+        return n;
+    }
+    _bodyStreamed = true;
+    istream& is = _request.stream();
+    if(size == 0 || !is){
+        return 0;
+    }
+    is.read(buffer, size);
+    const size_t n = static_cast<size_t>(is.gcount());
+    _bodyConsumed += n;
+    if(_maxBodySize > 0 && _bodyConsumed > _maxBodySize){
+        throw PayloadTooLargeException();
+    }
+    return n;
+}
+
+string& ServerRequestProviderHTTP::body(){
+    if(!_bodyStrReady){
+        if(_bodyReady){
+            //The raw body has been requested before
+            _bodyStr.assign(_body.begin(), _body.size());
+        }else{
+            _readPayload(_bodyStr);
+        }
+        _bodyStrReady = true;
     }
     return _bodyStr;
 }
 
+string_view ServerRequestProviderHTTP::bodyView(){
+    if(_bodyStrReady){
+        return _bodyStr;
+    }
+    Buffer<char>& body = bodyRaw();
+    return string_view(body.begin(), body.size());
+}
+
 Buffer<char>& ServerRequestProviderHTTP::bodyRaw(){
     if(!_bodyReady){
-        _readPayload();
+        if(_bodyStrReady){
+            //The text body has been requested before
+            _body.assign(_bodyStr.data(), _bodyStr.size());
+        }else{
+            _readPayload(_body);
+        }
+        _bodyReady = true;
     }
     return _body;
 }
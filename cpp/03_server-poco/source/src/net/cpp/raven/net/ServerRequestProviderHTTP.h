@@ -17,12 +17,20 @@
 #ifndef RAVEN_NET_SERVER_REQUEST_PROVIDER_HTTP_H
 #define RAVEN_NET_SERVER_REQUEST_PROVIDER_HTTP_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
 
 #include "Poco/Buffer.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/NameValueCollection.h"
 
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/HeaderHTTP.h"
+
 
 namespace raven {
 namespace net {
@@ -32,14 +40,49 @@ namespace net {
  */
 class ServerRequestProviderHTTP {
 
+    /**
+     * A query parameter as slices of the request URI. The decoded
+     * value is only determined when the value is first read.
+     */
+    struct QueryEntry {
+        std::string_view name;
+        std::string_view value;
+        std::string_view decoded;
+        bool isDecoded;
+    };
+
+    /**
+     * A cookie as slices of the Cookie header value.
+     */
+    struct CookieEntry {
+        std::string_view name;
+        std::string_view value;
+    };
+
     Poco::Net::HTTPServerRequest& _request;
     Poco::Buffer<char> _body;
     Poco::Net::NameValueCollection _queryParams;
     std::string _bodyStr;
     std::string _uriPath;
+    std::vector<PathParam> _pathParams;
+    std::string_view _uriPathView;
+    std::vector<QueryEntry> _queryEntries;
+    std::deque<std::string> _decoded;
+    std::vector<CookieEntry> _cookies;
+    const std::string* _headerIndex[HEADER_HTTP_COUNT];
+    std::size_t _maxBodySize = 0;
+    std::size_t _bodyConsumed = 0;
+    MethodHTTP _method = MethodHTTP::HTTP_OTHER;
     bool _bodyReady = false;
+    bool _bodyStrReady = false;
     bool _uriPathReady = false;
     bool _queryParamsReady = false;
+    bool _methodReady = false;
+    bool _uriParsed = false;
+    bool _bodyStreamed = false;
+    bool _headersIndexed = false;
+    bool _headersExposed = false;
+    bool _cookiesParsed = false;
 
 public:
 
@@ -49,23 +92,62 @@ public:
 
     std::string& getURIpath();
 
+    std::string_view getURIpathView();
+
+    std::string_view getQueryParam(std::string_view name);
+
+    bool hasQueryParam(std::string_view name);
+
+    std::vector<PathParam>& getPathParams();
+
     const std::string& getMethod();
 
+    MethodHTTP getMethodType();
+
     Poco::Net::NameValueCollection& getHeaders();
 
+    const std::string* getHeader(HeaderHTTP header);
+
+    const std::string* getHeader(std::string_view name);
+
     Poco::Net::NameValueCollection& getQueryParams();
 
+    std::string_view getCookie(std::string_view name);
+
+    bool hasCookie(std::string_view name);
+
+    std::int64_t getContentLength();
+
+    void setMaxBodySize(std::size_t size);
+
     std::string& body();
 
+    std::string_view bodyView();
+
     Poco::Buffer<char>& bodyRaw();
 
+    std::size_t readBody(char* buffer, std::size_t size);
+
     bool isSecure();
 
     Poco::Net::HTTPServerRequest& getServerRequest();
 
 private:
 
-    void _readPayload();
+    template<typename Storage>
+    void _readPayload(Storage& storage);
+
+    void _parseURI();
+
+    void _indexHeaders();
+
+    const std::string* _findHeader(std::string_view name);
+
+    QueryEntry* _findQueryEntry(std::string_view name);
+
+    void _parseCookies();
+
+    const CookieEntry* _findCookie(std::string_view name);
 
 }; // END CLASS ServerRequestProviderHTTP
 
@@ -67,6 +67,10 @@ ErrorHandler* ServerTCP::errorHandler(){
     return new DefaultErrorHandler();
 }
 
+shared_ptr<BroadcastBus> ServerTCP::broadcastBus(){
+    return nullptr;
+}
+
 HTTPRequestHandlerFactory* ServerTCP::requestHandlerFactory(
     shared_ptr<RouterHTTP> router){
 
@@ -100,6 +104,11 @@ int ServerTCP::main(const vector<string>& args){
             Log::warn("No router set for TCP server");
         }
 
+        _bus = broadcastBus();
+        if(_bus){
+            _bus->start();
+        }
+
         onStartRequested();
 
         //Create socket
@@ -119,6 +128,10 @@ int ServerTCP::main(const vector<string>& args){
 
         onStopRequested();
 
+        if(_bus){
+            _bus->stop();
+        }
+
         SessionHandler::getInstance().stopAllSessions();
 
         //Stop the server
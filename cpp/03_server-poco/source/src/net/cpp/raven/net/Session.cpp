@@ -15,19 +15,32 @@
  */
 
 #include <memory>
+#include <cstddef>
 #include <string>
+#include <chrono>
+#include <future>
 #include <exception>
+#include <atomic>
 
 #include "raven/net/Session.h"
 #include "raven/net/WebSocketSessionProvider.h"
+#include "raven/net/FileTransfer.h"
 
 
 namespace raven {
 namespace net {
 
+using std::size_t;
 using std::shared_ptr;
+using std::make_shared;
 using std::string;
+using std::promise;
+using std::future;
 using std::runtime_error;
+using std::chrono::milliseconds;
+
+//The maximum payload size of a control frame, in bytes
+static const size_t SESSION_MAX_PING_PAYLOAD = 125;
 
 Session::Session(shared_ptr<WebSocketSessionProvider> session){
     if(!session){
@@ -36,15 +49,53 @@ Session::Session(shared_ptr<WebSocketSessionProvider> session){
         );
     }
     _session = session;
+    for(size_t i = 0; i < SESSION_MAX_ATTRIBUTES; ++i){
+        _attributes[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+Session::~Session(){
+    for(size_t i = 0; i < SESSION_MAX_ATTRIBUTES; ++i){
+        void* value = _attributes[i].load(std::memory_order_acquire);
+        if(value){
+            SessionAttributeRegistry::destroy(i, value);
+        }
+    }
+}
+
+void* Session::_initAttribute(size_t slot, void* value){
+    void* current = nullptr;
+    if(!_attributes[slot].compare_exchange_strong(
+        current, value, std::memory_order_acq_rel)){
+
+        //Another thread has created the value first
+        SessionAttributeRegistry::destroy(slot, value);
+        return current;
+    }
+    return value;
 }
 
-string Session::getID() const{
+const string& Session::getID() const{
     if(_session){
         return _session->getID();
     }
     throw runtime_error("Invalid session state");
 }
 
+string Session::getResumeToken() const{
+    if(_session){
+        return _session->getResumeToken();
+    }
+    throw runtime_error("Invalid session state");
+}
+
+bool Session::isResumed() const{
+    if(_session){
+        return _session->isResumed();
+    }
+    throw runtime_error("Invalid session state");
+}
+
 void Session::close(){
     if(_session){
         _session->close();
@@ -59,11 +110,115 @@ bool Session::isClosed() const{
 }
 
 void Session::send(const string& message){
+    send(message, MessagePriority::INTERACTIVE);
+}
+
+void Session::send(const string& message, MessagePriority priority){
     if(_session){
-        _session->send(message);
+        _session->send(message, priority);
     }
 }
 
+void Session::send(
+    const string& message,
+    MessagePriority priority,
+    SendCallback onComplete){
+
+    if(_session){
+        _session->send(message, priority, onComplete);
+    }else if(onComplete){
+        onComplete(SendStatus::DROPPED, 0);
+    }
+}
+
+future<SendStatus> Session::sendAsync(
+    const string& message,
+    MessagePriority priority){
+
+    shared_ptr<promise<SendStatus>> result = make_shared<promise<SendStatus>>();
+    send(message, priority, [result](SendStatus status, size_t){
+        result->set_value(status);
+    });
+    return result->get_future();
+}
+
+void Session::sendBinary(string data){
+    sendBinary(std::move(data), MessagePriority::INTERACTIVE, nullptr);
+}
+
+void Session::sendBinary(string data, MessagePriority priority){
+    sendBinary(std::move(data), priority, nullptr);
+}
+
+void Session::sendBinary(
+    string data,
+    MessagePriority priority,
+    SendCallback onComplete){
+
+    if(_session){
+        _session->sendBinary(std::move(data), priority, onComplete);
+    }else if(onComplete){
+        onComplete(SendStatus::DROPPED, 0);
+    }
+}
+
+void Session::sendPing(const string& payload){
+    if(payload.size() > SESSION_MAX_PING_PAYLOAD){
+        throw runtime_error("Ping payload must not exceed 125 bytes");
+    }
+    if(_session){
+        _session->sendControl(make_shared<Message>(2, payload));
+    }
+}
+
+void Session::sendFile(const string& path){
+    sendFile(path, MessagePriority::BULK, nullptr, nullptr);
+}
+
+void Session::sendFile(
+    const string& path,
+    MessagePriority priority,
+    ProgressCallback onProgress,
+    SendCallback onComplete){
+
+    if(_session){
+        shared_ptr<FileTransfer> transfer = make_shared<FileTransfer>(
+            _session, path, priority, onProgress, onComplete);
+
+        transfer->start(_session->getOptions().fileChunkWindow);
+    }else if(onComplete){
+        onComplete(SendStatus::DROPPED, 0);
+    }
+}
+
+size_t Session::getQueueDepth() const{
+    if(_session){
+        return _session->getQueueDepth();
+    }
+    throw runtime_error("Invalid session state");
+}
+
+milliseconds Session::getQueueAge() const{
+    if(_session){
+        return _session->getQueueAge();
+    }
+    throw runtime_error("Invalid session state");
+}
+
+double Session::getSendRate() const{
+    if(_session){
+        return _session->getSendRate();
+    }
+    throw runtime_error("Invalid session state");
+}
+
+SessionStats Session::getStats() const{
+    if(_session){
+        return _session->getStats();
+    }
+    throw runtime_error("Invalid session state");
+}
+
 shared_ptr<WebSocketSessionProvider> Session::getSessionProvider(){
     return _session;
 }
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <atomic>
+#include <stdexcept>
+
+#include "raven/net/SessionAttribute.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::atomic;
+using std::runtime_error;
+
+static atomic<size_t> SA_NEXT_SLOT(0);
+static atomic<SessionAttributeDeleter> SA_DELETERS[SESSION_MAX_ATTRIBUTES];
+
+size_t SessionAttributeRegistry::registerAttribute(
+    SessionAttributeDeleter deleter){
+
+    const size_t slot = SA_NEXT_SLOT.fetch_add(1);
+    if(slot >= SESSION_MAX_ATTRIBUTES){
+        throw runtime_error("Too many session attributes registered");
+    }
+    SA_DELETERS[slot].store(deleter, std::memory_order_release);
+    return slot;
+}
+
+void SessionAttributeRegistry::destroy(size_t slot, void* value){
+    SessionAttributeDeleter deleter =
+        SA_DELETERS[slot].load(std::memory_order_acquire);
+
+    if(deleter){
+        deleter(value);
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <memory>
+#include <cstddef>
+#include <string>
+
+#include "raven/net/SessionGroups.h"
+#include "raven/net/SessionHandler.h"
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace net {
+
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+
+bool SessionGroups::join(Session& session, const string& group){
+    SessionHandler& handler = SessionHandler::getInstance();
+    shared_ptr<Session> sp = handler.getSessionBy(session);
+    if(sp.get() != &session){
+        //Session is not registered (anymore)
+        return false;
+    }
+    return handler.joinGroup(sp, group);
+}
+
+bool SessionGroups::leave(Session& session, const string& group){
+    return SessionHandler::getInstance().leaveGroup(session, group);
+}
+
+size_t SessionGroups::send(const string& group, const string& message){
+    return send(group, message, MessagePriority::INTERACTIVE);
+}
+
+size_t SessionGroups::send(
+    const string& group,
+    const string& message,
+    MessagePriority priority){
+
+    return SessionHandler::getInstance().sendToGroup(group, message, priority);
+}
+
+size_t SessionGroups::size(const string& group){
+    return SessionHandler::getInstance().getGroupSize(group);
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
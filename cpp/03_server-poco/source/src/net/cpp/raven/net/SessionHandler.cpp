@@ -8,18 +8,28 @@
  * of this code, in any form, requires formal consent by the creator.
  */
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <mutex>
+#include <shared_mutex>
+#include <chrono>
+#include <algorithm>
 
-#include "Poco/UUID.h"
 #include "Poco/UUIDGenerator.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Net/NameValueCollection.h"
 
 #include "raven/net/SessionHandler.h"
 #include "raven/net/Session.h"
+#include "raven/net/Message.h"
 #include "raven/net/WebSocketSessionProvider.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/WebSocketHandler.h"
+#include "raven/net/WebSocketOptions.h"
+#include "raven/net/SessionReplayBuffer.h"
 #include "raven/util/Log.h"
 
 
@@ -29,14 +39,79 @@ namespace net {
 using std::shared_ptr;
 using std::make_shared;
 using std::string;
+using std::size_t;
+using std::uint64_t;
+using std::vector;
 using std::lock_guard;
 using std::mutex;
-using Poco::UUID;
+using std::shared_lock;
+using std::unique_lock;
+using std::shared_mutex;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
 using Poco::UUIDGenerator;
+using Poco::NumberParser;
+using Poco::Net::NameValueCollection;
 using raven::util::Log;
 
-UUID SessionHandler::createSessionID(){
-    return UUIDGenerator::defaultGenerator().createOne();
+SessionID SessionHandler::createSessionID(){
+    return SessionID::generate();
+}
+
+string SessionHandler::createResumeToken(){
+    return UUIDGenerator::defaultGenerator().createRandom().toString();
+}
+
+void SessionHandler::_purgeSuspended(){
+    const steady_clock::time_point now = steady_clock::now();
+    for(auto it = _suspended.begin(); it != _suspended.end();){
+        if(it->second.expiry <= now){
+            it = _suspended.erase(it);
+        }else{
+            ++it;
+        }
+    }
+}
+
+shared_ptr<SessionReplayBuffer> SessionHandler::_takeSuspended(
+    RequestHTTP& request){
+
+    NameValueCollection& params = request.getQueryParams();
+    const string token = params.get("resumeToken", "");
+    if(token.empty()){
+        return nullptr;
+    }
+    Poco::UInt64 lastSeq = 0;
+    if(!NumberParser::tryParseUnsigned64(params.get("lastSeq", "0"), lastSeq)){
+        Log::debug("Cannot resume session: Invalid sequence number");
+        return nullptr;
+    }
+    return resumeSession(request.getURIpath(), token, lastSeq);
+}
+
+shared_ptr<SessionReplayBuffer> SessionHandler::resumeSession(
+    const string& route,
+    const string& token,
+    uint64_t lastSeq){
+
+    const lock_guard<mutex> lock(_suspendedMutex);
+    _purgeSuspended();
+    auto item = _suspended.find(token);
+    if(item == _suspended.end()){
+        Log::debug("Cannot resume session: Unknown or expired token");
+        return nullptr;
+    }
+    shared_ptr<SessionReplayBuffer> replay = item->second.replay;
+    if(replay->getRoute() != route){
+        Log::debug("Cannot resume session: Token belongs to another route");
+        return nullptr;
+    }
+    _suspended.erase(item);
+    if(!replay->claim(lastSeq)){
+        Log::debug("Cannot resume session: Missed messages are unavailable");
+        return nullptr;
+    }
+    return replay;
 }
 
 shared_ptr<Session> SessionHandler::createSession(
@@ -44,49 +119,230 @@ shared_ptr<Session> SessionHandler::createSession(
     ResponseHTTP& response,
     shared_ptr<WebSocketHandler> handler){
 
-    const lock_guard<mutex> lock(_mutex);
-    UUID uuid = createSessionID();
+    return createSession(request, response, handler, WebSocketOptions());
+}
+
+shared_ptr<Session> SessionHandler::createSession(
+    RequestHTTP& request,
+    ResponseHTTP& response,
+    shared_ptr<WebSocketHandler> handler,
+    const WebSocketOptions& options){
+
+    shared_ptr<SessionReplayBuffer> replay;
+    bool resumed = false;
+    if(options.resumable){
+        replay = _takeSuspended(request);
+        resumed = (replay != nullptr);
+        if(!resumed){
+            replay = make_shared<SessionReplayBuffer>(
+                createSessionID(),
+                createResumeToken(),
+                request.getURIpath(),
+                options.replayBufferSize
+            );
+        }
+    }
+    const SessionID sid = replay ? replay->getID() : createSessionID();
     shared_ptr<WebSocketSessionProvider> sp = 
         make_shared<WebSocketSessionProvider>(
-            uuid, request, response, handler
+            sid, request, response, handler, replay, resumed
         );
 
     shared_ptr<Session> session = make_shared<Session>(sp);
 
-    string sid = uuid.toString();
-    _sessions[sid] = session;
-    Log::debug("Session with ID '" + session->getID() + "' created");
-    return _sessions[sid];
+    _sessions.insert(sid.getKey(), session);
+    Log::debug(
+        "Session with ID '" + session->getID()
+        + (resumed ? "' resumed" : "' created"));
+
+    return session;
 }
 
 shared_ptr<Session> SessionHandler::getSessionBy(const std::string& sid){
-    const lock_guard<mutex> lock(_mutex);
-    try{
-        return _sessions.at(sid);
-    }catch(const std::out_of_range&){
+    SessionKey key;
+    if(!SessionID::parse(sid, key)){
         return nullptr;
     }
+    return _sessions.find(key);
+}
+
+shared_ptr<Session> SessionHandler::getSessionBy(const SessionKey& key){
+    return _sessions.find(key);
+}
+
+shared_ptr<Session> SessionHandler::getSessionBy(Session& session){
+    return _sessions.find(
+        session.getSessionProvider()->getSessionID().getKey());
+}
+
+vector<shared_ptr<Session>> SessionHandler::getAllSessions(){
+    return _sessions.getAll();
 }
 
 bool SessionHandler::clear(shared_ptr<Session> session){
-    const lock_guard<mutex> lock(_mutex);
-    if(session){
-        string sid = session->getID();
-        if(_sessions.find(sid) == _sessions.end()){
-            //Session does not exist in map
-            return false;
+    if(!session){
+        return false;
+    }
+    leaveAllGroups(*session);
+    const SessionID& sid = session->getSessionProvider()->getSessionID();
+    if(!_sessions.erase(sid.getKey())){
+        //Session does not exist in map
+        return false;
+    }
+    Log::debug("Session with ID '" + sid.toString() + "' cleared");
+    return true;
+}
+
+bool SessionHandler::_removeMember(const Session& session, const string& group){
+    auto item = _groups.find(group);
+    if(item == _groups.end()){
+        return false;
+    }
+    SessionGroup& members = item->second;
+    auto pos = members.index.find(&session);
+    if(pos == members.index.end()){
+        return false;
+    }
+    //Swap with the last member to keep the array contiguous
+    const size_t i = pos->second;
+    members.index.erase(pos);
+    if(i != members.members.size() - 1){
+        members.members[i] = std::move(members.members.back());
+        members.index[members.members[i].get()] = i;
+    }
+    members.members.pop_back();
+    if(members.members.empty()){
+        _groups.erase(item);
+    }else{
+        members.snapshot = make_shared<const vector<shared_ptr<Session>>>(
+            members.members);
+    }
+    return true;
+}
+
+bool SessionHandler::joinGroup(shared_ptr<Session> session, const string& group){
+    if(!session){
+        return false;
+    }
+    const unique_lock<shared_mutex> lock(_groupsMutex);
+    //Checked under the lock, a Session is closed before it leaves all
+    //groups, so it cannot join again after leaveAllGroups() has run
+    if(session->isClosed()){
+        return false;
+    }
+    SessionGroup& members = _groups[group];
+    if(members.index.find(session.get()) != members.index.end()){
+        return false;
+    }
+    members.index[session.get()] = members.members.size();
+    members.members.push_back(session);
+    members.snapshot = make_shared<const vector<shared_ptr<Session>>>(
+        members.members);
+
+    _memberships[session.get()].push_back(group);
+    return true;
+}
+
+bool SessionHandler::leaveGroup(const Session& session, const string& group){
+    const unique_lock<shared_mutex> lock(_groupsMutex);
+    if(!_removeMember(session, group)){
+        return false;
+    }
+    auto item = _memberships.find(&session);
+    if(item != _memberships.end()){
+        vector<string>& groups = item->second;
+        groups.erase(std::remove(groups.begin(), groups.end(), group), groups.end());
+        if(groups.empty()){
+            _memberships.erase(item);
         }
-        _sessions.erase(sid);
-        Log::debug("Session with ID '" + sid + "' cleared");
-        return true;
     }
-    return false;
+    return true;
+}
+
+void SessionHandler::leaveAllGroups(const Session& session){
+    const unique_lock<shared_mutex> lock(_groupsMutex);
+    auto item = _memberships.find(&session);
+    if(item == _memberships.end()){
+        return;
+    }
+    for(const string& group : item->second){
+        _removeMember(session, group);
+    }
+    _memberships.erase(item);
+}
+
+size_t SessionHandler::sendToGroup(
+    const string& group,
+    const string& message,
+    MessagePriority priority){
+
+    shared_ptr<const vector<shared_ptr<Session>>> members;
+    {
+        //Send without holding the lock, sending can run callbacks
+        //which join or leave groups
+        const shared_lock<shared_mutex> lock(_groupsMutex);
+        auto item = _groups.find(group);
+        if(item == _groups.end()){
+            return 0;
+        }
+        members = item->second.snapshot;
+    }
+    _sendToEach(*members, message, priority);
+    return members->size();
+}
+
+size_t SessionHandler::sendToAll(
+    const string& message,
+    MessagePriority priority){
+
+    const vector<shared_ptr<Session>> sessions = _sessions.getAll();
+    _sendToEach(sessions, message, priority);
+    return sessions.size();
+}
+
+void SessionHandler::_sendToEach(
+    const vector<shared_ptr<Session>>& sessions,
+    const string& message,
+    MessagePriority priority){
+
+    //All sessions share the same immutable message
+    const shared_ptr<Message> msg = make_shared<Message>(message);
+    for(const shared_ptr<Session>& session : sessions){
+        session->getSessionProvider()->sendMessage(msg, priority, nullptr);
+    }
+}
+
+size_t SessionHandler::getGroupSize(const string& group){
+    const shared_lock<shared_mutex> lock(_groupsMutex);
+    auto item = _groups.find(group);
+    return (item != _groups.end()) ? item->second.members.size() : 0;
+}
+
+void SessionHandler::suspendSession(
+    shared_ptr<Session> session,
+    milliseconds gracePeriod){
+
+    if(!session){
+        return;
+    }
+    shared_ptr<SessionReplayBuffer> replay =
+        session->getSessionProvider()->getReplayBuffer();
+
+    if(!replay){
+        return;
+    }
+    const lock_guard<mutex> lock(_suspendedMutex);
+    _purgeSuspended();
+    _suspended[replay->getToken()] = SuspendedSession{
+        replay,
+        steady_clock::now() + gracePeriod
+    };
+    Log::debug("Session with ID '" + session->getID() + "' suspended");
 }
 
 void SessionHandler::stopAllSessions(){
-    const lock_guard<mutex> lock(_mutex);
-    for(auto item : _sessions){
-        item.second->close();
+    for(const shared_ptr<Session>& session : _sessions.getAll()){
+        session->close();
     }
 }
 
@@ -19,11 +19,14 @@
 
 #include <memory>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <mutex>
+#include <shared_mutex>
+#include <chrono>
 #include <unordered_map>
 
-#include "Poco/UUID.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
 
@@ -31,6 +34,10 @@
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/WebSocketHandler.h"
+#include "raven/net/WebSocketOptions.h"
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/SessionRegistry.h"
+#include "raven/net/SessionID.h"
 
 
 namespace raven {
@@ -45,8 +52,32 @@ namespace net {
  */
 class SessionHandler {
 
-    std::unordered_map<std::string, std::shared_ptr<Session>> _sessions;
-    std::mutex _mutex;
+    /**
+     * A disconnected resumable session.
+     */
+    struct SuspendedSession {
+        std::shared_ptr<SessionReplayBuffer> replay;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    /**
+     * The members of a session group. Members are kept in a contiguous
+     * array, with an index for constant time removal. An immutable copy
+     * of the array is rebuilt whenever members join or leave, so that
+     * senders can iterate over it without holding the groups lock.
+     */
+    struct SessionGroup {
+        std::vector<std::shared_ptr<Session>> members;
+        std::unordered_map<const Session*, std::size_t> index;
+        std::shared_ptr<const std::vector<std::shared_ptr<Session>>> snapshot;
+    };
+
+    SessionRegistry _sessions;
+    std::unordered_map<std::string, SuspendedSession> _suspended;
+    std::mutex _suspendedMutex;
+    std::unordered_map<std::string, SessionGroup> _groups;
+    std::unordered_map<const Session*, std::vector<std::string>> _memberships;
+    std::shared_mutex _groupsMutex;
 
     //private constructor
     SessionHandler(){ }
@@ -56,9 +87,62 @@ class SessionHandler {
      * within the surrounding system process but not necessarily
      * across process/application boundaries
      * 
-     * @return A unique session ID, as a UUID.
+     * @return A unique session ID.
+     */
+    SessionID createSessionID();
+
+    /**
+     * Creates a random, hard to guess token which clients must
+     * present in order to resume a session.
+     * 
+     * @return A new resume token.
+     */
+    std::string createResumeToken();
+
+    /**
+     * Takes the suspended session referenced by the resume parameters
+     * of the specified request, if it exists and can still be resumed.
+     * 
+     * @param request The RequestHTTP of the resuming connection.
+     * 
+     * @return The SessionReplayBuffer of the resumed session, or null
+     *         if the request does not resume a session.
+     */
+    std::shared_ptr<SessionReplayBuffer> _takeSuspended(RequestHTTP& request);
+
+    /**
+     * Removes all suspended sessions whose grace period has expired.
+     * The caller must hold the suspended sessions lock.
+     */
+    void _purgeSuspended();
+
+    /**
+     * Removes the specified Session from the member array of the
+     * specified group and rebuilds its snapshot. Empty groups are
+     * removed entirely. The caller must hold the exclusive groups lock.
+     * 
+     * @param session The Session to remove.
+     * @param group The name of the group.
+     * 
+     * @return True if the Session was a member of the group,
+     *         false otherwise.
+     */
+    bool _removeMember(const Session& session, const std::string& group);
+
+    /**
+     * Sends the specified message to each of the specified sessions.
+     * All sessions share a single Message instance. The caller must
+     * not hold the groups lock.
+     * 
+     * @param sessions The sessions to send the message to.
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
      */
-    Poco::UUID createSessionID();
+    void _sendToEach(
+        const std::vector<std::shared_ptr<Session>>& sessions,
+        const std::string& message,
+        MessagePriority priority);
 
 public:
 
@@ -78,6 +162,26 @@ public:
         ResponseHTTP& response,
         std::shared_ptr<WebSocketHandler> handler);
 
+    /**
+     * Creates a new Session from the specified RequestHTTP
+     * and ResponseHTTP objects, using the specified WebSocketOptions.
+     * If the options enable resumable sessions and the request carries
+     * the parameters of a suspended session, then that session is
+     * resumed instead, keeping its ID.
+     * 
+     * @param request The RequestHTTP to create a Session for.
+     * @param response The ResponseHTTP to create a Session for.
+     * @param handler The WebSocketHandler to create a Session for.
+     * @param options The WebSocketOptions of the web socket route.
+     * 
+     * @return A new Session.
+     */
+    std::shared_ptr<Session> createSession(
+        RequestHTTP& request,
+        ResponseHTTP& response,
+        std::shared_ptr<WebSocketHandler> handler,
+        const WebSocketOptions& options);
+
     SessionHandler(SessionHandler const&) = delete;
 
     void operator=(SessionHandler const&) = delete;
@@ -92,6 +196,33 @@ public:
      */
     std::shared_ptr<Session> getSessionBy(const std::string& sid);
 
+    /**
+     * Returns the Session with the specified key.
+     * 
+     * @param key The binary form of the ID of the session to get.
+     * 
+     * @return A shared pointer to the Session with the specified key,
+     *         or null if no Session exists with the specified key.
+     */
+    std::shared_ptr<Session> getSessionBy(const SessionKey& key);
+
+    /**
+     * Returns the registered shared pointer of the specified Session.
+     * 
+     * @param session The Session to get the shared pointer for.
+     * 
+     * @return A shared pointer to the specified Session, or null
+     *         if the Session is not registered (anymore).
+     */
+    std::shared_ptr<Session> getSessionBy(Session& session);
+
+    /**
+     * Returns all currently registered sessions.
+     * 
+     * @return A snapshot of all registered sessions.
+     */
+    std::vector<std::shared_ptr<Session>> getAllSessions();
+
     /**
      * Removes the specified Session from this handler.
      * 
@@ -102,6 +233,105 @@ public:
      */
     bool clear(std::shared_ptr<Session> session);
 
+    /**
+     * Keeps the state of the specified disconnected Session for the
+     * specified grace period, so that a client can resume it. Has no
+     * effect if the specified Session is not resumable.
+     * 
+     * @param session The Session to suspend.
+     * @param gracePeriod The duration for which the Session
+     *                    can be resumed.
+     */
+    void suspendSession(
+        std::shared_ptr<Session> session,
+        std::chrono::milliseconds gracePeriod);
+
+    /**
+     * Takes the suspended session with the specified resume token, if its
+     * grace period has not expired yet, and claims it for a new connection.
+     * A session can only be resumed on the route it was created on.
+     * A suspended session is discarded when the missed messages can no
+     * longer be replayed.
+     * 
+     * @param route The URI path of the resuming connection.
+     * @param token The resume token presented by the client.
+     * @param lastSeq The sequence number of the last message
+     *                received by the client.
+     * 
+     * @return The SessionReplayBuffer of the resumed session, or null
+     *         if the session cannot be resumed.
+     */
+    std::shared_ptr<SessionReplayBuffer> resumeSession(
+        const std::string& route,
+        const std::string& token,
+        std::uint64_t lastSeq);
+
+    /**
+     * Adds the specified Session to the specified group.
+     * 
+     * @param session The Session to add.
+     * @param group The name of the group.
+     * 
+     * @return True if the Session was added, false if it
+     *         already is a member of the group or is closed.
+     */
+    bool joinGroup(std::shared_ptr<Session> session, const std::string& group);
+
+    /**
+     * Removes the specified Session from the specified group.
+     * 
+     * @param session The Session to remove.
+     * @param group The name of the group.
+     * 
+     * @return True if the Session was removed, false if it
+     *         is not a member of the group.
+     */
+    bool leaveGroup(const Session& session, const std::string& group);
+
+    /**
+     * Removes the specified Session from all groups it is a member of.
+     * 
+     * @param session The Session to remove.
+     */
+    void leaveAllGroups(const Session& session);
+
+    /**
+     * Sends the specified message to all members of the specified group.
+     * The message is sent to the members of the group at the time of the
+     * call, without holding the groups lock.
+     * 
+     * @param group The name of the group.
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * 
+     * @return The number of members the message was sent to.
+     */
+    std::size_t sendToGroup(
+        const std::string& group,
+        const std::string& message,
+        MessagePriority priority);
+
+    /**
+     * Sends the specified message to all open sessions.
+     * 
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * 
+     * @return The number of sessions the message was sent to.
+     */
+    std::size_t sendToAll(const std::string& message, MessagePriority priority);
+
+    /**
+     * Returns the number of members of the specified group.
+     * 
+     * @param group The name of the group.
+     * 
+     * @return The number of members of the group.
+     */
+    std::size_t getGroupSize(const std::string& group);
+
     /**
      * Terminates all open session.
      */
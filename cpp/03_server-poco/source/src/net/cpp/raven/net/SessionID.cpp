@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <random>
+#include <atomic>
+
+#include "raven/net/SessionID.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint64_t;
+using std::string;
+
+static const char* SID_HEX_DIGITS = "0123456789abcdef";
+
+//Length of the string form, i.e. 32 hex digits and 4 dashes
+static const size_t SID_LENGTH = 36;
+
+static uint64_t _splitMix64(uint64_t& state){
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * A xoshiro256** pseudo random number generator. Each thread uses its
+ * own instance, seeded once from std::random_device.
+ */
+class SessionIDGenerator {
+
+    uint64_t _s[4];
+
+    static uint64_t _rotl(uint64_t x, int k){
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+
+    SessionIDGenerator(){
+        static std::atomic<uint64_t> instances(0);
+        std::random_device device;
+        //Distinct seeds even if the device is deterministic
+        uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+        seed ^= instances.fetch_add(1) * 0xd1b54a32d192ed03ULL;
+        for(uint64_t& s : _s){
+            s = _splitMix64(seed);
+        }
+    }
+
+    uint64_t next(){
+        const uint64_t result = _rotl(_s[1] * 5, 7) * 9;
+        const uint64_t t = _s[1] << 17;
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= t;
+        _s[3] = _rotl(_s[3], 45);
+        return result;
+    }
+
+}; // END CLASS SessionIDGenerator
+
+static void _appendHex(string& str, uint64_t value, int from, int to){
+    //Appends the hex digits of the nibbles [from, to) counted from the left
+    for(int i = from; i < to; ++i){
+        str.push_back(SID_HEX_DIGITS[(value >> (60 - (i * 4))) & 0xf]);
+    }
+}
+
+static int _hexValue(char c){
+    if(c >= '0' && c <= '9'){
+        return c - '0';
+    }
+    if(c >= 'a' && c <= 'f'){
+        return c - 'a' + 10;
+    }
+    if(c >= 'A' && c <= 'F'){
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+SessionID::SessionID(const SessionKey& key)
+    :_key(key){
+
+    _text.reserve(SID_LENGTH);
+    _appendHex(_text, key.high, 0, 8);
+    _text.push_back('-');
+    _appendHex(_text, key.high, 8, 12);
+    _text.push_back('-');
+    _appendHex(_text, key.high, 12, 16);
+    _text.push_back('-');
+    _appendHex(_text, key.low, 0, 4);
+    _text.push_back('-');
+    _appendHex(_text, key.low, 4, 16);
+}
+
+SessionID SessionID::generate(){
+    thread_local SessionIDGenerator generator;
+    SessionKey key{generator.next(), generator.next()};
+    //Mark as a version 4, variant 1 UUID
+    key.high = (key.high & ~uint64_t(0xf000)) | uint64_t(0x4000);
+    key.low = (key.low & ~(uint64_t(0xc0) << 56)) | (uint64_t(0x80) << 56);
+    return SessionID(key);
+}
+
+bool SessionID::parse(const string& text, SessionKey& key){
+    if(text.size() != SID_LENGTH){
+        return false;
+    }
+    uint64_t half[2] = {0, 0};
+    int digits = 0;
+    for(size_t i = 0; i < SID_LENGTH; ++i){
+        const char c = text[i];
+        if(i == 8 || i == 13 || i == 18 || i == 23){
+            if(c != '-'){
+                return false;
+            }
+            continue;
+        }
+        const int value = _hexValue(c);
+        if(value < 0){
+            return false;
+        }
+        uint64_t& h = half[digits / 16];
+        h = (h << 4) | static_cast<uint64_t>(value);
+        ++digits;
+    }
+    key.high = half[0];
+    key.low = half[1];
+    return true;
+}
+
+const SessionKey& SessionID::getKey() const{
+    return _key;
+}
+
+const string& SessionID::toString() const{
+    return _text;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
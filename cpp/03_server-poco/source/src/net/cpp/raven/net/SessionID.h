@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_ID_H
+#define RAVEN_NET_SESSION_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * The binary form of a session ID.
+ */
+struct SessionKey {
+
+    std::uint64_t high;
+    std::uint64_t low;
+
+    bool operator==(const SessionKey& other) const{
+        return high == other.high && low == other.low;
+    }
+
+}; // END STRUCT SessionKey
+
+/**
+ * Hash function for SessionKey objects. Session keys are random,
+ * so mixing both halves is sufficient.
+ */
+struct SessionKeyHash {
+
+    std::size_t operator()(const SessionKey& key) const{
+        return static_cast<std::size_t>(
+            key.low ^ (key.high * 0x9e3779b97f4a7c15ULL));
+    }
+
+}; // END STRUCT SessionKeyHash
+
+/**
+ * A session ID consisting of a random 128-bit SessionKey and its
+ * precomputed string form. The string form has the format of a
+ * version 4 UUID. IDs are generated by a per-thread generator without
+ * any locking. Unlike resume tokens, session IDs are not meant to be
+ * secret and are not generated by a cryptographically secure source.
+ */
+class SessionID {
+
+    SessionKey _key;
+    std::string _text;
+
+public:
+
+    /**
+     * Constructs a new SessionID from the specified key.
+     * 
+     * @param key The binary form of the ID.
+     */
+    SessionID(const SessionKey& key);
+
+    /**
+     * Generates a new random SessionID.
+     * 
+     * @return A new SessionID which is unique within the process
+     *         with overwhelming probability.
+     */
+    static SessionID generate();
+
+    /**
+     * Parses the string form of a session ID into its binary form.
+     * This method does not allocate memory or throw exceptions.
+     * 
+     * @param text The string form of a session ID.
+     * @param key Is set to the parsed key on success.
+     * 
+     * @return True if the specified string is a valid session ID,
+     *         false otherwise.
+     */
+    static bool parse(const std::string& text, SessionKey& key);
+
+    /**
+     * Returns the binary form of this ID.
+     * 
+     * @return The SessionKey of this ID.
+     */
+    const SessionKey& getKey() const;
+
+    /**
+     * Returns the string form of this ID.
+     * 
+     * @return The string form of this ID.
+     */
+    const std::string& toString() const;
+
+}; // END CLASS SessionID
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_ID_H
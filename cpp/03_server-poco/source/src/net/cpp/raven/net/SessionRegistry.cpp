@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <cstddef>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+
+#include "raven/net/SessionRegistry.h"
+#include "raven/net/Session.h"
+#include "raven/net/SessionID.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::shared_ptr;
+using std::vector;
+using std::shared_lock;
+using std::unique_lock;
+using std::shared_mutex;
+
+SessionRegistry::SessionRegistry(){ }
+
+SessionRegistry::Shard& SessionRegistry::_shardOf(const SessionKey& key){
+    //Keys are random, so their upper bits select the shard directly
+    //and the lower bits are left to the hash of the shard map
+    return _shards[(key.high >> 32) & (SR_NUM_SHARDS - 1)];
+}
+
+void SessionRegistry::insert(const SessionKey& key, shared_ptr<Session> session){
+    Shard& shard = _shardOf(key);
+    const unique_lock<shared_mutex> lock(shard.mutex);
+    shard.sessions[key] = std::move(session);
+}
+
+shared_ptr<Session> SessionRegistry::find(const SessionKey& key){
+    Shard& shard = _shardOf(key);
+    const shared_lock<shared_mutex> lock(shard.mutex);
+    auto item = shard.sessions.find(key);
+    if(item == shard.sessions.end()){
+        return nullptr;
+    }
+    return item->second;
+}
+
+bool SessionRegistry::erase(const SessionKey& key){
+    Shard& shard = _shardOf(key);
+    const unique_lock<shared_mutex> lock(shard.mutex);
+    return shard.sessions.erase(key) > 0;
+}
+
+vector<shared_ptr<Session>> SessionRegistry::getAll(){
+    vector<shared_ptr<Session>> all;
+    for(size_t i = 0; i < SR_NUM_SHARDS; ++i){
+        const shared_lock<shared_mutex> lock(_shards[i].mutex);
+        for(const auto& item : _shards[i].sessions){
+            all.push_back(item.second);
+        }
+    }
+    return all;
+}
+
+size_t SessionRegistry::size(){
+    size_t total = 0;
+    for(size_t i = 0; i < SR_NUM_SHARDS; ++i){
+        const shared_lock<shared_mutex> lock(_shards[i].mutex);
+        total += _shards[i].sessions.size();
+    }
+    return total;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_REGISTRY_H
+#define RAVEN_NET_SESSION_REGISTRY_H
+
+#include <memory>
+#include <cstddef>
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "raven/net/Session.h"
+#include "raven/net/SessionID.h"
+
+
+namespace raven {
+namespace net {
+
+//The number of shards of a SessionRegistry, must be a power of two
+static const std::size_t SR_NUM_SHARDS = 64;
+
+/**
+ * A concurrent map of all open sessions, keyed by the binary
+ * form of their session ID.
+ * The map is split into a fixed number of shards, each guarded by
+ * its own reader-writer lock, so that concurrent operations on
+ * different sessions rarely contend with each other. Lookups never
+ * throw exceptions.
+ * 
+ * All methods of this class are thread-safe.
+ */
+class SessionRegistry {
+
+    /**
+     * A single shard, aligned to a cache line to avoid false sharing
+     * between the locks of adjacent shards.
+     */
+    struct alignas(64) Shard {
+        std::shared_mutex mutex;
+        std::unordered_map<SessionKey, std::shared_ptr<Session>, SessionKeyHash>
+            sessions;
+    };
+
+    Shard _shards[SR_NUM_SHARDS];
+
+public:
+
+    SessionRegistry();
+
+    SessionRegistry(SessionRegistry const&) = delete;
+
+    void operator=(SessionRegistry const&) = delete;
+
+    /**
+     * Adds the specified Session under the specified key, replacing
+     * any Session previously registered under that key.
+     * 
+     * @param key The key of the Session.
+     * @param session The Session to add.
+     */
+    void insert(const SessionKey& key, std::shared_ptr<Session> session);
+
+    /**
+     * Returns the Session with the specified key.
+     * 
+     * @param key The key of the Session to get.
+     * 
+     * @return The Session with the specified key, or null
+     *         if no such Session is registered.
+     */
+    std::shared_ptr<Session> find(const SessionKey& key);
+
+    /**
+     * Removes the Session with the specified key.
+     * 
+     * @param key The key of the Session to remove.
+     * 
+     * @return True if a Session was removed, false otherwise.
+     */
+    bool erase(const SessionKey& key);
+
+    /**
+     * Returns all currently registered sessions. The shards are visited
+     * one after another, so the result is not an atomic snapshot.
+     * 
+     * @return A list of all registered sessions.
+     */
+    std::vector<std::shared_ptr<Session>> getAll();
+
+    /**
+     * Returns the number of currently registered sessions.
+     * 
+     * @return The number of registered sessions.
+     */
+    std::size_t size();
+
+private:
+
+    /**
+     * Returns the shard responsible for the specified key.
+     * 
+     * @param key The key of a Session.
+     * 
+     * @return The shard holding the Session with the specified key.
+     */
+    Shard& _shardOf(const SessionKey& key);
+
+}; // END CLASS SessionRegistry
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_REGISTRY_H
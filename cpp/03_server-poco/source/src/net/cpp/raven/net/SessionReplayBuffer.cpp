@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <mutex>
+
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/WebSocketWriter.h"
+
+
+namespace raven {
+namespace net {
+
+using std::shared_ptr;
+using std::size_t;
+using std::uint64_t;
+using std::string;
+using std::lock_guard;
+using std::mutex;
+
+SessionReplayBuffer::SessionReplayBuffer(
+    const SessionID& id,
+    const string& token,
+    const string& route,
+    size_t capacity)
+    :_id(id),
+     _token(token),
+     _route(route),
+     _ring(capacity){ }
+
+const SessionID& SessionReplayBuffer::getID() const{
+    return _id;
+}
+
+const string& SessionReplayBuffer::getToken() const{
+    return _token;
+}
+
+const string& SessionReplayBuffer::getRoute() const{
+    return _route;
+}
+
+void SessionReplayBuffer::send(
+    shared_ptr<Message> msg,
+    MessagePriority priority,
+    SendCallback done){
+
+    SendStatus status = SendStatus::BUFFERED;
+    {
+        const lock_guard<mutex> lock(_mutex);
+        _keep(msg, priority);
+        if(_writer){
+            //Queue under the lock to keep the order of sent messages,
+            //the writer calls the callback once the message is written
+            if(_writer->enqueue(msg, priority, done)){
+                return;
+            }
+            status = SendStatus::DROPPED;
+        }
+    }
+    //The callback is called without holding the lock
+    //as it may send on the same session again
+    if(done){
+        done(status, 0);
+    }
+}
+
+void SessionReplayBuffer::_keep(
+    shared_ptr<Message> msg,
+    MessagePriority priority){
+
+    if(!_writer && _unsent.size() >= _ring.size()){
+        //The oldest missed message is lost
+        _overflowed = true;
+        if(_unsent.empty()){
+            return;
+        }
+        _unsent.pop_front();
+    }
+    _unsent.push_back(Entry{0, msg, priority});
+}
+
+void SessionReplayBuffer::written(
+    const shared_ptr<Message>& msg,
+    MessagePriority priority){
+
+    const lock_guard<mutex> lock(_mutex);
+    for(auto it = _unsent.begin(); it != _unsent.end(); ++it){
+        if(it->msg == msg){
+            _unsent.erase(it);
+            break;
+        }
+    }
+    Entry entry{_nextSeq++, msg, priority};
+    if(!_ring.empty()){
+        if(_count < _ring.size()){
+            _ring[(_head + _count) % _ring.size()] = entry;
+            ++_count;
+        }else{
+            //Buffer is full, overwrite the oldest entry
+            _ring[_head] = entry;
+            _head = (_head + 1) % _ring.size();
+        }
+    }
+}
+
+bool SessionReplayBuffer::claim(uint64_t lastSeq){
+    const lock_guard<mutex> lock(_mutex);
+    const uint64_t oldestSeq = (_count > 0) ? _ring[_head].seq : _nextSeq;
+    if(_overflowed || lastSeq >= _nextSeq || lastSeq + 1 < oldestSeq){
+        return false;
+    }
+    //Written messages which the client has not received are
+    //sent again before all messages that were not written yet
+    while(_count > 0){
+        Entry& entry = _ring[(_head + _count - 1) % _ring.size()];
+        if(entry.seq <= lastSeq){
+            break;
+        }
+        _unsent.push_front(entry);
+        entry = Entry{};
+        --_count;
+    }
+    _nextSeq = lastSeq + 1;
+    return true;
+}
+
+void SessionReplayBuffer::attach(WebSocketWriter& writer){
+    const lock_guard<mutex> lock(_mutex);
+    for(const Entry& entry : _unsent){
+        writer.enqueue(entry.msg, entry.priority, nullptr);
+    }
+    _writer = &writer;
+}
+
+void SessionReplayBuffer::detach(WebSocketWriter& writer){
+    const lock_guard<mutex> lock(_mutex);
+    if(_writer == &writer){
+        _writer = nullptr;
+    }
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_REPLAY_BUFFER_H
+#define RAVEN_NET_SESSION_REPLAY_BUFFER_H
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+
+#include "raven/net/Message.h"
+#include "raven/net/SessionID.h"
+
+
+namespace raven {
+namespace net {
+
+//Forward declaration
+class WebSocketWriter;
+
+/**
+ * Keeps the state of a resumable session across connections. Outbound
+ * messages are handed to the WebSocketWriter of the connection that is
+ * currently attached, if any, and are kept until they are written. Each
+ * written message is assigned the next sequence number and recorded in a
+ * bounded ring buffer. Sequence numbers therefore follow the order in which
+ * the client receives the messages, regardless of their priority lanes.
+ * When a client resumes the session, all messages it has missed are
+ * replayed to the new connection.
+ * 
+ * All methods of this class are thread-safe.
+ */
+class SessionReplayBuffer {
+
+    /**
+     * A recorded outbound message.
+     */
+    struct Entry {
+        std::uint64_t seq;
+        std::shared_ptr<Message> msg;
+        MessagePriority priority;
+    };
+
+    const SessionID _id;
+    const std::string _token;
+    const std::string _route;
+    std::mutex _mutex;
+    std::vector<Entry> _ring;
+    std::deque<Entry> _unsent;
+    std::size_t _head = 0;
+    std::size_t _count = 0;
+    std::uint64_t _nextSeq = 1;
+    WebSocketWriter* _writer = nullptr;
+    bool _overflowed = false;
+
+public:
+
+    /**
+     * Constructs a new SessionReplayBuffer.
+     * 
+     * @param id The ID of the session.
+     * @param token The secret token a client must present
+     *              to resume the session.
+     * @param route The URI path the session was created on.
+     * @param capacity The maximum number of messages to keep for replay.
+     */
+    SessionReplayBuffer(
+        const SessionID& id,
+        const std::string& token,
+        const std::string& route,
+        std::size_t capacity);
+
+    /**
+     * Returns the ID of the session.
+     * 
+     * @return The session ID.
+     */
+    const SessionID& getID() const;
+
+    /**
+     * Returns the token to be presented by a client to resume the session.
+     * 
+     * @return The resume token.
+     */
+    const std::string& getToken() const;
+
+    /**
+     * Returns the URI path of the web socket route the session was
+     * created on. A session can only be resumed on the same path.
+     * 
+     * @return The route of the session.
+     */
+    const std::string& getRoute() const;
+
+    /**
+     * Keeps the specified outbound message until it is written and sends
+     * it through the currently attached WebSocketWriter, if any. While no
+     * connection is attached, at most as many messages as the capacity of
+     * this buffer are kept. Older messages are discarded, in which case
+     * the session can no longer be resumed.
+     * 
+     * @param msg The message to send.
+     * @param priority The priority lane to put the message into.
+     * @param done The completion callback. Is invoked with
+     *             SendStatus::BUFFERED if no connection is attached.
+     *             Is never called while this buffer is locked, so it
+     *             may send on the same session again. May be null.
+     */
+    void send(
+        std::shared_ptr<Message> msg,
+        MessagePriority priority,
+        SendCallback done);
+
+    /**
+     * Records the specified message as written to the remote endpoint and
+     * assigns it the next sequence number. Is called by the writer thread
+     * of a connection for each written message which is not a control
+     * message, also after the writer has been detached.
+     * 
+     * @param msg The written message.
+     * @param priority The priority lane of the message.
+     */
+    void written(const std::shared_ptr<Message>& msg, MessagePriority priority);
+
+    /**
+     * Claims this buffer for a resuming connection. All written messages
+     * with a sequence number greater than the specified one are scheduled
+     * to be sent again, ahead of all messages not written yet, once a
+     * WebSocketWriter is attached. Sequence numbering continues after the
+     * specified one. The claim fails when the specified sequence number
+     * has not been assigned yet or when missed messages have already been
+     * discarded from the buffer.
+     * 
+     * @param lastSeq The sequence number of the last message
+     *                received by the client.
+     * 
+     * @return True if all missed messages can be replayed, false otherwise.
+     */
+    bool claim(std::uint64_t lastSeq);
+
+    /**
+     * Attaches the specified WebSocketWriter to this buffer. All messages
+     * which have not been written yet, including those scheduled for
+     * replay, are sent first, followed by all subsequently sent messages.
+     * 
+     * @param writer The writer of the connection to attach.
+     */
+    void attach(WebSocketWriter& writer);
+
+    /**
+     * Detaches the specified WebSocketWriter from this buffer.
+     * Has no effect if the writer is not currently attached.
+     * 
+     * @param writer The writer of the connection to detach.
+     */
+    void detach(WebSocketWriter& writer);
+
+private:
+
+    /**
+     * Keeps the specified message until it is written.
+     * The caller must hold the buffer lock.
+     * 
+     * @param msg The message to keep.
+     * @param priority The priority lane of the message.
+     */
+    void _keep(std::shared_ptr<Message> msg, MessagePriority priority);
+
+}; // END CLASS SessionReplayBuffer
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_REPLAY_BUFFER_H
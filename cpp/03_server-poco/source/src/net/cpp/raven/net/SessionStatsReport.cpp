@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Poco/NumberParser.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NameValueCollection.h"
+
+#include "raven/net/SessionStatsReport.h"
+#include "raven/net/SessionStats.h"
+#include "raven/net/SessionHandler.h"
+#include "raven/net/Session.h"
+
+
+namespace raven {
+namespace net {
+
+using std::shared_ptr;
+using std::size_t;
+using std::int64_t;
+using std::string;
+using std::vector;
+using std::ostringstream;
+using std::chrono::system_clock;
+using std::chrono::milliseconds;
+using Poco::NumberParser;
+using Poco::JSON::Object;
+using Poco::JSON::Array;
+using Poco::Net::HTTPResponse;
+using Poco::Net::NameValueCollection;
+
+static const unsigned SSR_DEFAULT_LIMIT = 100;
+static const unsigned SSR_MAX_LIMIT = 1000;
+
+typedef bool (*SessionStatsOrder)(const SessionStats&, const SessionStats&);
+
+static int64_t _toMillis(system_clock::time_point time){
+    return std::chrono::duration_cast<milliseconds>(
+        time.time_since_epoch()).count();
+}
+
+static SessionStatsOrder _orderBy(const string& field){
+    if(field == "bytesOut"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.bytesOut > b.bytesOut;
+        };
+    }else if(field == "bytesIn"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.bytesIn > b.bytesIn;
+        };
+    }else if(field == "messagesOut"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.messagesOut > b.messagesOut;
+        };
+    }else if(field == "messagesIn"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.messagesIn > b.messagesIn;
+        };
+    }else if(field == "queueDepth"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.queueDepth > b.queueDepth;
+        };
+    }else if(field == "connectedAt"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.connectedAt < b.connectedAt;
+        };
+    }else if(field == "lastActivity"){
+        return [](const SessionStats& a, const SessionStats& b){
+            return a.lastActivity < b.lastActivity;
+        };
+    }
+    return nullptr;
+}
+
+static Object::Ptr _toJSON(const SessionStats& stats){
+    Object::Ptr obj = new Object();
+    obj->set("id", stats.id);
+    obj->set("messagesIn", stats.messagesIn);
+    obj->set("bytesIn", stats.bytesIn);
+    obj->set("messagesOut", stats.messagesOut);
+    obj->set("bytesOut", stats.bytesOut);
+    obj->set("queueDepth", static_cast<Poco::UInt64>(stats.queueDepth));
+    obj->set("connectedAt", _toMillis(stats.connectedAt));
+    obj->set("lastActivity", _toMillis(stats.lastActivity));
+    return obj;
+}
+
+void SessionStatsReport::handle(RequestHTTP& request, ResponseHTTP& response){
+    vector<SessionStats> stats;
+    for(const shared_ptr<Session>& session
+        : SessionHandler::getInstance().getAllSessions()){
+
+        stats.push_back(session->getStats());
+    }
+    report(request, response, stats);
+}
+
+void SessionStatsReport::report(
+    RequestHTTP& request,
+    ResponseHTTP& response,
+    vector<SessionStats>& stats){
+
+    NameValueCollection& params = request.getQueryParams();
+    SessionStatsOrder order = _orderBy(params.get("sort", "bytesOut"));
+    unsigned offset = 0;
+    unsigned limit = SSR_DEFAULT_LIMIT;
+    if(!order
+        || !NumberParser::tryParseUnsigned(params.get("offset", "0"), offset)
+        || !NumberParser::tryParseUnsigned(
+                params.get("limit", std::to_string(SSR_DEFAULT_LIMIT)), limit)){
+
+        response.setStatus(HTTPResponse::HTTPStatus::HTTP_BAD_REQUEST)
+                .body("Error 400: Bad Request");
+        return;
+    }
+    limit = std::min(limit, SSR_MAX_LIMIT);
+
+    const size_t begin = std::min<size_t>(offset, stats.size());
+    const size_t end = std::min<size_t>(begin + limit, stats.size());
+    //Only the requested page needs to be in order
+    std::partial_sort(stats.begin(), stats.begin() + end, stats.end(), order);
+
+    Array::Ptr page = new Array();
+    for(size_t i = begin; i < end; ++i){
+        page->add(_toJSON(stats[i]));
+    }
+    Object result;
+    result.set("total", static_cast<Poco::UInt64>(stats.size()));
+    result.set("offset", offset);
+    result.set("limit", limit);
+    result.set("sessions", page);
+
+    ostringstream os;
+    result.stringify(os);
+    response.setContentType("application/json").body(os.str());
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
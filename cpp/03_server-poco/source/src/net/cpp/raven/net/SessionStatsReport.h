@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_STATS_REPORT_H
+#define RAVEN_NET_SESSION_STATS_REPORT_H
+
+#include <vector>
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/SessionStats.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Handles requests to the session statistics route of a router.
+ * Responds with the SessionStats of all registered sessions as JSON.
+ * 
+ * The following query parameters are supported:
+ *   sort:   The counter to sort by. One of 'bytesOut' (default),
+ *           'bytesIn', 'messagesOut', 'messagesIn' and 'queueDepth',
+ *           which are sorted in descending order, or 'connectedAt' and
+ *           'lastActivity', which are sorted oldest first.
+ *   offset: The number of sessions to skip. Defaults to 0.
+ *   limit:  The maximum number of sessions to return. Defaults to 100,
+ *           at most 1000.
+ */
+class SessionStatsReport {
+
+public:
+
+    static void handle(RequestHTTP& request, ResponseHTTP& response);
+
+    /**
+     * Responds with the specified SessionStats, sorted and paged according
+     * to the query parameters of the specified request. Invalid query
+     * parameters are answered with a 400 response.
+     * 
+     * @param request The RequestHTTP carrying the query parameters.
+     * @param response The ResponseHTTP to write the report to.
+     * @param stats The statistics to report. Are reordered in place.
+     */
+    static void report(
+        RequestHTTP& request,
+        ResponseHTTP& response,
+        std::vector<SessionStats>& stats);
+
+}; // END CLASS SessionStatsReport
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_STATS_REPORT_H
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <chrono>
+
+#include "raven/net/SlowConsumerDetector.h"
+#include "raven/net/WebSocketWriter.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::chrono::steady_clock;
+
+SlowConsumerDetector::SlowConsumerDetector(const WebSocketOptions& options)
+    :_maxDepth(options.slowConsumerQueueDepth),
+     _maxAge(options.slowConsumerQueueAge),
+     _evict(options.evictSlowConsumers),
+     _isLagging(false),
+     _isEvicted(false){ }
+
+bool SlowConsumerDetector::isEnabled() const{
+    return _maxDepth > 0 || _maxAge.count() > 0;
+}
+
+bool SlowConsumerDetector::check(WebSocketWriterQueue& queue){
+    if(!isEnabled()){
+        return false;
+    }
+    const size_t depth = queue.size();
+    if(depth == 0){
+        //The remote endpoint has caught up
+        _isLagging = false;
+        return false;
+    }
+    bool lagging = _maxDepth > 0 && depth > _maxDepth;
+    if(!lagging && _maxAge.count() > 0){
+        steady_clock::time_point oldest;
+        lagging = queue.oldest(oldest)
+            && (steady_clock::now() - oldest) > _maxAge;
+    }
+    if(!lagging || _isLagging.exchange(true)){
+        return false;
+    }
+    if(_evict){
+        _isEvicted = true;
+    }
+    return true;
+}
+
+bool SlowConsumerDetector::isLagging() const{
+    return _isLagging;
+}
+
+bool SlowConsumerDetector::isEvicted() const{
+    return _isEvicted;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
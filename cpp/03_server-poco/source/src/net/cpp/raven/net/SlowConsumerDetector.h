@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_SLOW_CONSUMER_DETECTOR_H
+#define RAVEN_NET_SLOW_CONSUMER_DETECTOR_H
+
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+
+#include "raven/net/WebSocketOptions.h"
+
+
+namespace raven {
+namespace net {
+
+// Forward declaration
+class WebSocketWriterQueue;
+
+/**
+ * Checks the outbound queue of a single web socket session against the
+ * slow consumer thresholds of its WebSocketOptions. A session starts
+ * lagging when one of the thresholds is exceeded and stops lagging once
+ * its queue has been drained. An evicted session remains evicted.
+ * All methods of this class are thread-safe.
+ */
+class SlowConsumerDetector {
+
+    const std::size_t _maxDepth;
+    const std::chrono::milliseconds _maxAge;
+    const bool _evict;
+    std::atomic<bool> _isLagging;
+    std::atomic<bool> _isEvicted;
+
+public:
+
+    /**
+     * Constructs a new SlowConsumerDetector with the thresholds
+     * configured by the specified WebSocketOptions.
+     * 
+     * @param options The WebSocketOptions of the session.
+     */
+    SlowConsumerDetector(const WebSocketOptions& options);
+
+    /**
+     * Indicates whether any threshold is configured.
+     * 
+     * @return True if at least one threshold is configured, false otherwise.
+     */
+    bool isEnabled() const;
+
+    /**
+     * Checks the specified queue against the configured thresholds.
+     * If the session starts lagging with this check and eviction is
+     * configured, the session is marked as evicted.
+     * 
+     * @param queue The outbound queue of the session.
+     * 
+     * @return True if the session has started lagging with this check,
+     *         false if it is not lagging or was already lagging before.
+     */
+    bool check(WebSocketWriterQueue& queue);
+
+    /**
+     * Indicates whether the session is currently lagging.
+     * 
+     * @return True if the session is lagging, false otherwise.
+     */
+    bool isLagging() const;
+
+    /**
+     * Indicates whether the session was evicted because it was lagging.
+     * 
+     * @return True if the session was evicted, false otherwise.
+     */
+    bool isEvicted() const;
+
+}; // END CLASS SlowConsumerDetector
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SLOW_CONSUMER_DETECTOR_H
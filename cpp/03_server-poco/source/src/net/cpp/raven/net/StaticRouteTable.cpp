@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+
+#include "raven/net/StaticRouteTable.h"
+
+
+namespace raven {
+namespace net {
+
+using std::size_t;
+using std::uint64_t;
+using std::uint32_t;
+using std::string;
+using std::string_view;
+using std::vector;
+using std::pair;
+
+static const uint64_t SRT_HASH_SEED = 0x9E3779B97F4A7C15ULL;
+static const uint64_t SRT_HASH_MULTIPLIER = 0xFF51AFD7ED558CCDULL;
+
+static uint64_t _mix(uint64_t hash, uint64_t word){
+    hash = (hash ^ word) * SRT_HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+static uint64_t _hash(string_view path){
+    //Consume the path eight bytes at a time
+    uint64_t hash = SRT_HASH_SEED ^ path.size();
+    size_t i = 0;
+    for(; i + 8 <= path.size(); i += 8){
+        uint64_t word;
+        std::memcpy(&word, path.data() + i, 8);
+        hash = _mix(hash, word);
+    }
+    if(i < path.size()){
+        uint64_t word = 0;
+        for(size_t shift = 0; i < path.size(); ++i, shift += 8){
+            word |= static_cast<uint64_t>(
+                static_cast<unsigned char>(path[i])) << shift;
+        }
+        hash = _mix(hash, word);
+    }
+    return hash ^ (hash >> 29);
+}
+
+StaticRouteTable::StaticRouteTable(
+    const vector<pair<string, size_t>>& routes){
+
+    //Keep the load factor at or below one half for short probe sequences
+    size_t capacity = 4;
+    while(capacity < 2 * routes.size()){
+        capacity *= 2;
+    }
+    _mask = capacity - 1;
+    _slots.assign(capacity, Slot{0, 0, 0, NO_ROUTE});
+    for(const pair<string, size_t>& route : routes){
+        const uint64_t hash = _hash(route.first);
+        size_t i = hash & _mask;
+        while(_slots[i].route != NO_ROUTE){
+            i = (i + 1) & _mask;
+        }
+        _slots[i] = Slot{
+            hash,
+            static_cast<uint32_t>(_paths.size()),
+            static_cast<uint32_t>(route.first.size()),
+            route.second
+        };
+        _paths += route.first;
+    }
+}
+
+size_t StaticRouteTable::find(string_view path) const{
+    const uint64_t hash = _hash(path);
+    for(size_t i = hash & _mask; _slots[i].route != NO_ROUTE; i = (i + 1) & _mask){
+        const Slot& slot = _slots[i];
+        if(slot.hash == hash
+            && string_view(_paths.data() + slot.offset, slot.length) == path){
+
+            return slot.route;
+        }
+    }
+    return NO_ROUTE;
+}
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
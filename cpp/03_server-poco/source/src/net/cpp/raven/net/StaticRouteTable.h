@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_STATIC_ROUTE_TABLE_H
+#define RAVEN_NET_STATIC_ROUTE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * An immutable hash table which maps literal URI paths to route indices.
+ * All paths are known when the table is built, so it is sized once
+ * and stored as a flat array of slots with precomputed hashes, with
+ * all path strings in a single contiguous buffer. A lookup hashes
+ * the requested path once and then probes adjacent slots, comparing
+ * path strings only when the stored hash matches.
+ * 
+ * A StaticRouteTable is built once and is then only read, so concurrent
+ * calls to find() are safe.
+ */
+class StaticRouteTable {
+
+    struct Slot {
+        std::uint64_t hash;
+        std::uint32_t offset;
+        std::uint32_t length;
+        std::size_t route;
+    };
+
+    std::vector<Slot> _slots;
+    std::string _paths;
+    std::size_t _mask;
+
+public:
+
+    //Indicates that no route matches a path
+    static constexpr std::size_t NO_ROUTE = static_cast<std::size_t>(-1);
+
+    /**
+     * Builds a table of the specified routes.
+     * 
+     * @param routes The literal paths and indices of all routes.
+     *               The paths must be distinct.
+     */
+    StaticRouteTable(
+        const std::vector<std::pair<std::string, std::size_t>>& routes);
+
+    /**
+     * Finds the route with the specified path.
+     * 
+     * @param path The URI path to find.
+     * 
+     * @return The index of the route with the specified path,
+     *         or NO_ROUTE if there is no such route.
+     */
+    std::size_t find(std::string_view path) const;
+
+}; // END CLASS StaticRouteTable
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_STATIC_ROUTE_TABLE_H
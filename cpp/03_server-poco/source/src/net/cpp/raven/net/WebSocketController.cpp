@@ -38,6 +38,8 @@ void WebSocketController::onPingReceived(Session& session, Message& message){ }
 
 void WebSocketController::onPongReceived(Session& session, Message& message){ }
 
+void WebSocketController::onSlowConsumer(Session& session){ }
+
 void WebSocketController::onError(Session& session, const exception& ex){ }
 
 } // END NAMESPACE net
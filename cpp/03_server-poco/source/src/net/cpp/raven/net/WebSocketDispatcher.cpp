@@ -19,6 +19,7 @@
 #include "raven/net/WebSocketDispatcher.h"
 #include "raven/net/WebSocketHandler.h"
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/SessionHandler.h"
@@ -33,16 +34,28 @@ using std::make_shared;
 using raven::util::Log;
 
 WebSocketDispatcher::WebSocketDispatcher(WebSocketController& controller)
-    :_controller(controller){ }
+    :_binding(WebSocketControllerBinding::of(controller)){ }
+
+WebSocketDispatcher::WebSocketDispatcher(
+    WebSocketController& controller,
+    const WebSocketOptions& options)
+    :_binding(WebSocketControllerBinding::of(controller)),
+     _options(options){ }
+
+WebSocketDispatcher::WebSocketDispatcher(
+    const WebSocketControllerBinding& binding,
+    const WebSocketOptions& options)
+    :_binding(binding),
+     _options(options){ }
 
 void WebSocketDispatcher::dispatch(RequestHTTP& request, ResponseHTTP& response){
     try{
         shared_ptr<WebSocketHandler> handler = 
-            make_shared<WebSocketHandler>(_controller);
+            make_shared<WebSocketHandler>(_binding, _options);
 
         handler->setSession(
             SessionHandler::getInstance()
-                .createSession(request, response, handler)
+                .createSession(request, response, handler, _options)
             );
 
         handler->handle(request, response);
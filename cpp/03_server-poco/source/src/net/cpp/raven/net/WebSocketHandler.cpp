@@ -19,6 +19,7 @@
 
 #include "raven/net/WebSocketHandler.h"
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
 #include "raven/net/WebSocketSessionProvider.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
@@ -36,7 +37,25 @@ using std::string;
 using raven::util::Log;
 
 WebSocketHandler::WebSocketHandler(WebSocketController& controller)
-    :_controller(controller){
+    :_binding(WebSocketControllerBinding::of(controller)){
+
+    _session = nullptr;
+}
+
+WebSocketHandler::WebSocketHandler(
+    WebSocketController& controller,
+    const WebSocketOptions& options)
+    :_binding(WebSocketControllerBinding::of(controller)),
+     _options(options){
+
+    _session = nullptr;
+}
+
+WebSocketHandler::WebSocketHandler(
+    const WebSocketControllerBinding& binding,
+    const WebSocketOptions& options)
+    :_binding(binding),
+     _options(options){
 
     _session = nullptr;
 }
@@ -62,10 +81,14 @@ void WebSocketHandler::setSession(shared_ptr<Session> session){
     _session = session;
 }
 
+const WebSocketOptions& WebSocketHandler::getOptions() const{
+    return _options;
+}
+
 void WebSocketHandler::onConnect(){
     try{
         if(_session){
-            _controller.onConnect(*_session.get());
+            _binding.onConnect(_binding.controller, *_session.get());
         }
     }catch(const std::exception& ex){
         Log::error(
@@ -78,8 +101,12 @@ void WebSocketHandler::onDisconnect(){
     try{
         if(_session){
             _session->close();
-            SessionHandler::getInstance().clear(_session);
-            _controller.onDisconnect(*_session.get());
+            SessionHandler& sessions = SessionHandler::getInstance();
+            sessions.clear(_session);
+            if(_options.resumable){
+                sessions.suspendSession(_session, _options.resumeGracePeriod);
+            }
+            _binding.onDisconnect(_binding.controller, *_session.get());
         }
     }catch(const std::exception& ex){
         Log::error(
@@ -92,14 +119,14 @@ void WebSocketHandler::onDisconnect(){
 
 void WebSocketHandler::process(Message& message){
     try{
+        if(_session && message.isPing()){
+            //Answer on the CONTROL lane, so that the pong is
+            //not delayed by messages which are already queued
+            _session->getSessionProvider()->sendControl(
+                make_shared<Message>(3, message.getText()));
+        }
         if(_session){
-            if(message.isPing()){
-                _controller.onPingReceived(*_session.get(), message);
-            }else if(message.isPong()){
-                _controller.onPongReceived(*_session.get(), message);
-            }else{
-                _controller.onMessageReceived(*_session.get(), message);
-            }
+            _binding.onMessage(_binding.controller, *_session.get(), message);
         }
     }catch(const std::exception& ex){
         Log::error(
@@ -108,10 +135,28 @@ void WebSocketHandler::process(Message& message){
     }
 }
 
+void WebSocketHandler::onSlowConsumer(){
+    if(!_session){
+        return;
+    }
+    Log::warn("Session with ID '" + _session->getID() + "' is a slow consumer");
+    try{
+        _binding.onSlowConsumer(_binding.controller, *_session.get());
+    }catch(const std::exception& ex){
+        Log::error(
+            "WebSocketController.onSlowConsumer() has thrown uncaught exception"
+        );
+    }
+    if(_options.evictSlowConsumers){
+        Log::warn("Evicting slow consumer session '" + _session->getID() + "'");
+        _session->getSessionProvider()->abort();
+    }
+}
+
 void WebSocketHandler::processError(const std::exception& ex){
     try{
         if(_session){
-            _controller.onError(*_session.get(), ex);
+            _binding.onError(_binding.controller, *_session.get(), ex);
         }
     }catch(const std::exception& ex){
         Log::error(
@@ -26,6 +26,7 @@
 #include "raven/net/WebSocketReader.h"
 #include "raven/net/WebSocketHandler.h"
 #include "raven/net/WebSocketSessionProvider.h"
+#include "raven/net/InboundRateLimiter.h"
 #include "raven/net/Message.h"
 #include "raven/net/Session.h"
 #include "raven/util/Log.h"
@@ -52,7 +53,12 @@ using raven::util::Log;
 void WebSocketReader::_readerLoop(){
     _isRunning = true;
     shared_ptr<Session> session = _handler->getSession();
-    WebSocket& ws = session->getSessionProvider()->getWebSocket();
+    shared_ptr<WebSocketSessionProvider> provider =
+        session->getSessionProvider();
+
+    WebSocket& ws = provider->getWebSocket();
+    InboundRateLimiter limiter(_handler->getOptions());
+    bool limitExceeded = false;
     try{
         Buffer<char> buffer(4096);
         int flags;
@@ -75,9 +81,22 @@ void WebSocketReader::_readerLoop(){
                                == WebSocket::FRAME_OP_PONG){
 
                     type = 3;
+                }else if((flags & WebSocket::FRAME_OP_BITMASK)
+                               == WebSocket::FRAME_OP_BINARY){
+
+                    type = 4;
+                }
+                provider->recordInbound(buffer.size());
+                RateLimitDecision decision = limiter.admit(flags, buffer.size());
+                if(decision == RateLimitDecision::CLOSE){
+                    Log::debug("WebSocketReader: Inbound rate limit exceeded");
+                    limitExceeded = true;
+                    break;
+                }
+                if(decision == RateLimitDecision::ACCEPT){
+                    Message msg(type, string(buffer.begin(), buffer.size()));
+                    _handler->process(msg);
                 }
-                Message msg(type, string(buffer.begin(), buffer.size()));
-                _handler->process(msg);
                 buffer.resize(0);
             }
             if(n == 0 && flags == 0){
@@ -97,7 +116,11 @@ void WebSocketReader::_readerLoop(){
         Log::error("WebSocketReader: Connection unknown error");
     }
     try{
-        ws.shutdown();
+        if(limitExceeded){
+            ws.shutdown(WebSocket::WS_POLICY_VIOLATION, "Rate limit exceeded");
+        }else{
+            ws.shutdown();
+        }
     }catch(const Exception& ex){
         Log::warn("WebSocketReader: WebSocket shutdown has thrown exception");
     }
@@ -15,29 +15,37 @@
  */
 
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <chrono>
+#include <stdexcept>
 
-#include "Poco/UUID.h"
+#include "Poco/Exception.h"
 #include "Poco/Timespan.h"
-#include "Poco/UUIDGenerator.h"
 #include "Poco/Net/WebSocket.h"
+#include "Poco/Net/StreamSocket.h"
 
 #include "raven/net/WebSocketSessionProvider.h"
 #include "raven/net/WebSocketReader.h"
 #include "raven/net/WebSocketWriter.h"
 #include "raven/net/WebSocketHandler.h"
+#include "raven/net/SessionReplayBuffer.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ServerRequestProviderHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/ServerResponseProviderHTTP.h"
+#include "raven/util/Log.h"
 
 
 namespace raven {
 namespace net {
 
+using std::size_t;
 using std::shared_ptr;
+using std::make_shared;
 using std::string;
-using Poco::UUID;
+using std::chrono::system_clock;
 using Poco::Timespan;
 using Poco::Net::HTTPServerRequest;
 using Poco::Net::HTTPServerResponse;
@@ -46,45 +54,106 @@ using Poco::Net::WebSocket;
 using raven::net::WebSocketReader;
 using raven::net::WebSocketWriter;
 using raven::net::Message;
+using raven::util::Log;
 
 WebSocketSessionProvider::WebSocketSessionProvider(
-    UUID id,
+    const SessionID& id,
     RequestHTTP& request,
     ResponseHTTP& response,
-    shared_ptr<WebSocketHandler> handler)
+    shared_ptr<WebSocketHandler> handler,
+    shared_ptr<SessionReplayBuffer> replay,
+    bool resumed)
     :_id(id),
-     _ws(WebSocket(
+     _ws(new WebSocket(
         request.getProvider().getServerRequest(),
         response.getProvider().getServerResponse())),
-     _wsReader(WebSocketReader(handler)),
-     _wsWriter(WebSocketWriter(handler)){
+     _wsReader(new WebSocketReader(handler)),
+     _wsWriter(new WebSocketWriter(handler)),
+     _replay(replay),
+     _options(handler->getOptions()),
+     _isResumed(resumed),
+     _isOpen(false),
+     _connectedAt(system_clock::now()),
+     _messagesIn(0),
+     _bytesIn(0),
+     _messagesOut(0),
+     _bytesOut(0),
+     _lastActivity(_connectedAt.time_since_epoch().count()){
 
     //Set timeout to infinity
-    _ws.setReceiveTimeout(Timespan());
+    _ws->setReceiveTimeout(Timespan());
     _isOpen = true;
 }
 
+WebSocketSessionProvider::WebSocketSessionProvider(
+    const SessionID& id,
+    const WebSocketOptions& options,
+    shared_ptr<SessionReplayBuffer> replay,
+    MessageSink sink)
+    :_id(id),
+     _sink(sink),
+     _replay(replay),
+     _options(options),
+     _isResumed(false),
+     _isOpen(true),
+     _connectedAt(system_clock::now()),
+     _messagesIn(0),
+     _bytesIn(0),
+     _messagesOut(0),
+     _bytesOut(0),
+     _lastActivity(_connectedAt.time_since_epoch().count()){ }
+
 void WebSocketSessionProvider::startThreads(){
-    _wsWriter.start();
-    _wsReader.start();
+    if(!_wsWriter){
+        return;
+    }
+    _wsWriter->start();
+    if(_replay){
+        _replay->attach(*_wsWriter);
+    }
+    _wsReader->start();
 }
 
 void WebSocketSessionProvider::stopThreads(){
-    _wsWriter.stop();
-    _wsReader.stop();
+    if(!_wsWriter){
+        return;
+    }
+    if(_replay){
+        _replay->detach(*_wsWriter);
+    }
+    _wsWriter->stop();
+    _wsReader->stop();
 }
 
-string WebSocketSessionProvider::getID(){
+const string& WebSocketSessionProvider::getID() const{
     return _id.toString();
 }
 
+const SessionID& WebSocketSessionProvider::getSessionID() const{
+    return _id;
+}
+
+string WebSocketSessionProvider::getResumeToken() const{
+    return _replay ? _replay->getToken() : string();
+}
+
+bool WebSocketSessionProvider::isResumed() const{
+    return _isResumed;
+}
+
+shared_ptr<SessionReplayBuffer> WebSocketSessionProvider::getReplayBuffer(){
+    return _replay;
+}
+
 WebSocket& WebSocketSessionProvider::getWebSocket(){
-    return _ws;
+    if(!_ws){
+        throw std::runtime_error("Session has no web socket connection");
+    }
+    return *_ws;
 }
 
 void WebSocketSessionProvider::close(){
-    if(_isOpen){
-        _isOpen = false;
+    if(_isOpen.exchange(false)){
         stopThreads();
     }
 }
@@ -93,8 +162,112 @@ bool WebSocketSessionProvider::isClosed() const{
     return !_isOpen;
 }
 
-void WebSocketSessionProvider::send(const string& message){
-    _wsWriter.sendText(message);
+void WebSocketSessionProvider::send(
+    const string& message,
+    MessagePriority priority){
+
+    send(message, priority, nullptr);
+}
+
+void WebSocketSessionProvider::send(
+    const string& message,
+    MessagePriority priority,
+    SendCallback done){
+
+    sendMessage(make_shared<Message>(message), priority, done);
+}
+
+void WebSocketSessionProvider::sendBinary(
+    string&& data,
+    MessagePriority priority,
+    SendCallback done){
+
+    sendMessage(make_shared<Message>(4, std::move(data)), priority, done);
+}
+
+void WebSocketSessionProvider::sendMessage(
+    shared_ptr<Message> msg,
+    MessagePriority priority,
+    SendCallback done){
+
+    if(_replay){
+        _replay->send(msg, priority, done);
+    }else if(_wsWriter){
+        _wsWriter->send(msg, priority, done);
+    }else{
+        _sink(msg, priority, done);
+    }
+}
+
+void WebSocketSessionProvider::sendControl(shared_ptr<Message> msg){
+    if(_wsWriter){
+        _wsWriter->send(msg, MessagePriority::CONTROL);
+    }else{
+        _sink(msg, MessagePriority::CONTROL, nullptr);
+    }
+}
+
+const WebSocketOptions& WebSocketSessionProvider::getOptions() const{
+    return _options;
+}
+
+size_t WebSocketSessionProvider::getQueueDepth() const{
+    return _wsWriter ? _wsWriter->getQueueDepth() : 0;
+}
+
+std::chrono::milliseconds WebSocketSessionProvider::getQueueAge(){
+    return _wsWriter
+        ? _wsWriter->getQueueAge()
+        : std::chrono::milliseconds(0);
+}
+
+double WebSocketSessionProvider::getSendRate() const{
+    return _wsWriter ? _wsWriter->getSendRate() : 0.0;
+}
+
+void WebSocketSessionProvider::recordInbound(size_t size){
+    //Counters are only read for reporting, so no ordering is required
+    _messagesIn.fetch_add(1, std::memory_order_relaxed);
+    _bytesIn.fetch_add(size, std::memory_order_relaxed);
+    _lastActivity.store(
+        system_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+}
+
+void WebSocketSessionProvider::recordOutbound(size_t size){
+    _messagesOut.fetch_add(1, std::memory_order_relaxed);
+    _bytesOut.fetch_add(size, std::memory_order_relaxed);
+    _lastActivity.store(
+        system_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+}
+
+SessionStats WebSocketSessionProvider::getStats() const{
+    SessionStats stats;
+    stats.id = _id.toString();
+    stats.messagesIn = _messagesIn.load(std::memory_order_relaxed);
+    stats.bytesIn = _bytesIn.load(std::memory_order_relaxed);
+    stats.messagesOut = _messagesOut.load(std::memory_order_relaxed);
+    stats.bytesOut = _bytesOut.load(std::memory_order_relaxed);
+    stats.queueDepth = getQueueDepth();
+    stats.connectedAt = _connectedAt;
+    stats.lastActivity = system_clock::time_point(system_clock::duration(
+        _lastActivity.load(std::memory_order_relaxed)));
+
+    return stats;
+}
+
+void WebSocketSessionProvider::abort(){
+    if(!_ws){
+        return;
+    }
+    try{
+        //Shut down the TCP connection itself, a close frame
+        //could block on the full socket buffer
+        _ws->StreamSocket::shutdown();
+    }catch(const Poco::Exception& ex){
+        Log::warn("WebSocketSessionProvider: Connection shutdown has failed");
+    }
 }
 
 } // END NAMESPACE net
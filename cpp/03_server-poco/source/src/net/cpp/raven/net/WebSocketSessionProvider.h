@@ -18,15 +18,25 @@
 #define RAVEN_NET_WEB_SOCKET_SESSION_PROVIDER_H
 
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <chrono>
+#include <atomic>
+#include <functional>
 
-#include "Poco/UUID.h"
 #include "Poco/Net/WebSocket.h"
 
+#include "raven/net/Message.h"
+#include "raven/net/WebSocketOptions.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/WebSocketReader.h"
 #include "raven/net/WebSocketWriter.h"
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/SessionStats.h"
+#include "raven/net/Session.h"
 
 
 namespace raven {
@@ -36,31 +46,126 @@ namespace net {
 class WebSocketHandler;
 
 /**
- * Implementation class for the Session type.
+ * Implementation class for the Session type. A Session forwards all
+ * operations to its provider without virtual dispatch.
  */
 class WebSocketSessionProvider {
 
-    Poco::UUID _id;
-    Poco::Net::WebSocket _ws;
-    WebSocketReader _wsReader;
-    WebSocketWriter _wsWriter;
-    bool _isOpen = false;
+protected:
+
+    /**
+     * Function receiving the outbound messages of a provider
+     * which does not have an underlying connection.
+     */
+    typedef std::function<void(
+        std::shared_ptr<Message>, MessagePriority, SendCallback)> MessageSink;
+
+private:
+
+    const SessionID _id;
+    std::unique_ptr<Poco::Net::WebSocket> _ws;
+    std::unique_ptr<WebSocketReader> _wsReader;
+    std::unique_ptr<WebSocketWriter> _wsWriter;
+    MessageSink _sink;
+    std::shared_ptr<SessionReplayBuffer> _replay;
+    const WebSocketOptions _options;
+    bool _isResumed;
+    std::atomic<bool> _isOpen;
+
+    //Traffic counters, only written by the reader and writer threads
+    const std::chrono::system_clock::time_point _connectedAt;
+    std::atomic<std::uint64_t> _messagesIn;
+    std::atomic<std::uint64_t> _bytesIn;
+    std::atomic<std::uint64_t> _messagesOut;
+    std::atomic<std::uint64_t> _bytesOut;
+    std::atomic<std::int64_t> _lastActivity;
 
 public:
 
     WebSocketSessionProvider(
-        Poco::UUID id,
+        const SessionID& id,
         RequestHTTP& request,
         ResponseHTTP& response,
-        std::shared_ptr<WebSocketHandler> handler);
+        std::shared_ptr<WebSocketHandler> handler,
+        std::shared_ptr<SessionReplayBuffer> replay,
+        bool resumed);
 
-    std::string getID();
+    WebSocketSessionProvider(WebSocketSessionProvider const&) = delete;
+
+    void operator=(WebSocketSessionProvider const&) = delete;
+
+    const std::string& getID() const;
+
+    const SessionID& getSessionID() const;
+
+    std::string getResumeToken() const;
+
+    bool isResumed() const;
+
+    std::shared_ptr<SessionReplayBuffer> getReplayBuffer();
 
     void close();
 
     bool isClosed() const;
 
-    void send(const std::string& message);
+    void send(const std::string& message, MessagePriority priority);
+
+    void send(
+        const std::string& message,
+        MessagePriority priority,
+        SendCallback done);
+
+    void sendBinary(
+        std::string&& data,
+        MessagePriority priority,
+        SendCallback done);
+
+    void sendMessage(
+        std::shared_ptr<Message> msg,
+        MessagePriority priority,
+        SendCallback done);
+
+    /**
+     * Sends the specified ping or pong message on the CONTROL lane.
+     * Control messages are not kept for replay, since they only
+     * concern the connection they are sent on.
+     * 
+     * @param msg The ping or pong message to send.
+     */
+    void sendControl(std::shared_ptr<Message> msg);
+
+    const WebSocketOptions& getOptions() const;
+
+    std::size_t getQueueDepth() const;
+
+    std::chrono::milliseconds getQueueAge();
+
+    double getSendRate() const;
+
+    /**
+     * Counts a message received from the client.
+     * Only called by the reader thread.
+     * 
+     * @param size The payload size of the message, in bytes.
+     */
+    void recordInbound(std::size_t size);
+
+    /**
+     * Counts a message written to the client.
+     * Only called by the writer thread.
+     * 
+     * @param size The payload size of the message, in bytes.
+     */
+    void recordOutbound(std::size_t size);
+
+    SessionStats getStats() const;
+
+    /**
+     * Shuts down the underlying connection without waiting for pending
+     * writes. Blocked reads and writes on the connection fail, which
+     * leads to the regular disconnect handling of the session.
+     */
+    void abort();
 
     void startThreads();
 
@@ -68,6 +173,27 @@ public:
 
     Poco::Net::WebSocket& getWebSocket();
 
+protected:
+
+    /**
+     * Constructs a WebSocketSessionProvider without an underlying
+     * connection, e.g. for test doubles. Outbound messages are passed
+     * to the specified sink on the thread of the sender, instead of
+     * being queued for a writer thread. If a replay buffer is specified,
+     * outbound messages are kept by it instead, as if the connection
+     * of a resumable session had dropped.
+     * 
+     * @param id The ID of the session.
+     * @param options The options of the session.
+     * @param replay The replay buffer of the session. May be null.
+     * @param sink The function receiving all outbound messages.
+     */
+    WebSocketSessionProvider(
+        const SessionID& id,
+        const WebSocketOptions& options,
+        std::shared_ptr<SessionReplayBuffer> replay,
+        MessageSink sink);
+
 }; // END CLASS WebSocketSessionProvider
 
 } // END NAMESPACE net
@@ -15,33 +15,68 @@
  */
 
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <thread>
 #include <string>
+#include <chrono>
 
 #include "Poco/Net/WebSocket.h"
 
 #include "raven/net/WebSocketWriter.h"
 #include "raven/net/WebSocketHandler.h"
+#include "raven/net/WebSocketOptions.h"
 #include "raven/net/Session.h"
 #include "raven/net/WebSocketSessionProvider.h"
+#include "raven/net/SessionReplayBuffer.h"
 #include "raven/util/Log.h"
 
 
 namespace raven {
 namespace net {
 
+using std::size_t;
 using std::shared_ptr;
 using std::make_shared;
 using std::string;
 using std::thread;
+using std::int64_t;
+using std::uint64_t;
+using std::chrono::steady_clock;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
 using Poco::Net::WebSocket;
 using raven::net::Session;
 using raven::util::Log;
 
+//The time window over which the send rate is measured, in nanoseconds
+static const int64_t WSW_RATE_WINDOW = 1000000000;
+
+static int64_t _nowNanos(){
+    return std::chrono::duration_cast<nanoseconds>(
+        steady_clock::now().time_since_epoch()).count();
+}
+
+static int _frameFlags(Message& msg){
+    if(msg.isBinary()){
+        return WebSocket::FRAME_BINARY;
+    }
+    if(msg.isPing()){
+        return WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PING;
+    }
+    if(msg.isPong()){
+        return WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG;
+    }
+    return WebSocket::FRAME_TEXT;
+}
+
 void WebSocketWriter::_writerLoop(){
-    _isRunning = true;
     shared_ptr<Session> session = _handler->getSession();
-    WebSocket& ws = session->getSessionProvider()->getWebSocket();
+    shared_ptr<WebSocketSessionProvider> provider =
+        session->getSessionProvider();
+
+    WebSocket& ws = provider->getWebSocket();
+    shared_ptr<SessionReplayBuffer> replay = provider->getReplayBuffer();
 
     bool terminate = false;
     while(!terminate){
@@ -53,14 +88,25 @@ void WebSocketWriter::_writerLoop(){
         if(!item.msg){
             continue;
         }
+        SendStatus status = SendStatus::WRITTEN;
         try{
             shared_ptr<Message> msg = item.msg;
-            const string& str = msg->getText();
-            const char* buffer = str.data();
-            ws.sendFrame(buffer, (int)str.length());
+            const char* buffer = msg->getData();
+            ws.sendFrame(buffer, (int)msg->getSize(), _frameFlags(*msg));
+            _recordWrite();
+            provider->recordOutbound(msg->getSize());
+            //Control messages are not kept for replay
+            if(replay && !msg->isPing() && !msg->isPong()){
+                replay->written(msg, item.priority);
+            }
         }catch(const std::exception& ex){
+            status = SendStatus::FAILED;
             _handler->processError(ex);
         }
+        _complete(item, status);
+        //The oldest pending message may exceed the age threshold
+        //even if no further messages are sent to the session
+        _checkLag();
     }
     _isRunning = false;
     Log::debug("WebSocketWriter: Thread terminating");
@@ -71,13 +117,18 @@ WSWQ_Item WebSocketWriter::_finalizationItem(){
 }
 
 WebSocketWriter::WebSocketWriter(shared_ptr<WebSocketHandler> handler)
-    :_queue(WebSocketWriterQueue()){
+    :_queue(WebSocketWriterQueue()),
+     _lag(handler->getOptions()){
 
     _handler = handler;
     _isRunning = false;
+    _rateWindowStart = _nowNanos();
+    _rateWindowCount = 0;
+    _sendRate = 0;
 }
 
 void WebSocketWriter::start(){
+    _isRunning = true;
     _thread = thread(&WebSocketWriter::_writerLoop, this);
 }
 
@@ -85,22 +136,108 @@ WebSocketWriterQueue& WebSocketWriter::getQueue(){
     return _queue;
 }
 
-void WebSocketWriter::send(shared_ptr<Message> msg){
-    if(_isRunning){
-        _queue.add(WSWQ_Item{false, msg});
+void WebSocketWriter::_complete(const WSWQ_Item& item, SendStatus status){
+    if(item.done){
+        try{
+            item.done(status, _queue.size());
+        }catch(const std::exception& ex){
+            Log::error("WebSocketWriter: Send callback has thrown exception");
+        }
+    }
+}
+
+void WebSocketWriter::send(shared_ptr<Message> msg, MessagePriority priority){
+    send(msg, priority, nullptr);
+}
+
+void WebSocketWriter::send(
+    shared_ptr<Message> msg,
+    MessagePriority priority,
+    SendCallback done){
+
+    if(!enqueue(msg, priority, done)){
+        _complete(WSWQ_Item{false, msg, priority, done}, SendStatus::DROPPED);
+    }
+}
+
+bool WebSocketWriter::enqueue(
+    shared_ptr<Message> msg,
+    MessagePriority priority,
+    SendCallback done){
+
+    //Messages are queued until the thread runs. The
+    //queue rejects all messages once it has been closed
+    if(_lag.isEvicted()){
+        return false;
+    }
+    return _queue.add(WSWQ_Item{false, msg, priority, done});
+}
+
+void WebSocketWriter::_checkLag(){
+    //Only called by the writer thread
+    if(_lag.check(_queue)){
+        _handler->onSlowConsumer();
+    }
+}
+
+void WebSocketWriter::_recordWrite(){
+    //Only called by the writer thread
+    const int64_t now = _nowNanos();
+    const int64_t start = _rateWindowStart.load(std::memory_order_relaxed);
+    const uint64_t count =
+        _rateWindowCount.load(std::memory_order_relaxed) + 1;
+
+    if(now - start >= WSW_RATE_WINDOW){
+        _sendRate.store(
+            (static_cast<double>(count) * 1e9) / (now - start),
+            std::memory_order_relaxed);
+
+        _rateWindowCount.store(0, std::memory_order_relaxed);
+        _rateWindowStart.store(now, std::memory_order_relaxed);
+    }else{
+        _rateWindowCount.store(count, std::memory_order_relaxed);
     }
 }
 
-void WebSocketWriter::sendText(const string& text){
-    send(make_shared<Message>(text));
+milliseconds WebSocketWriter::getQueueAge(){
+    steady_clock::time_point oldest;
+    if(!_queue.oldest(oldest)){
+        return milliseconds(0);
+    }
+    return std::chrono::duration_cast<milliseconds>(
+        steady_clock::now() - oldest);
+}
+
+double WebSocketWriter::getSendRate() const{
+    const int64_t elapsed =
+        _nowNanos() - _rateWindowStart.load(std::memory_order_relaxed);
+
+    if(elapsed >= 2 * WSW_RATE_WINDOW){
+        //The writer has not completed a window for a while
+        const uint64_t count = _rateWindowCount.load(std::memory_order_relaxed);
+        return (static_cast<double>(count) * 1e9) / elapsed;
+    }
+    return _sendRate.load(std::memory_order_relaxed);
+}
+
+size_t WebSocketWriter::getQueueDepth() const{
+    return _queue.size();
+}
+
+void WebSocketWriter::sendText(const string& text, MessagePriority priority){
+    send(make_shared<Message>(text), priority);
 }
 
 void WebSocketWriter::stop(){
-    if(_isRunning){
+    //Stop accepting new messages so that the queue can be drained
+    if(_isRunning.exchange(false)){
         Log::debug("WebSocketWriter: Stop requested");
         _queue.add(_finalizationItem());
         _thread.join();
-        _isRunning = false;
+        //Messages which were added after the queue was drained
+        for(const WSWQ_Item& item : _queue.close()){
+            _complete(item, SendStatus::DROPPED);
+        }
     }
 }
 
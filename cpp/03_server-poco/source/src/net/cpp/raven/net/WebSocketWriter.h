@@ -18,14 +18,18 @@
 #define RAVEN_NET_WEB_SOCKET_WRITER_H
 
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <deque>
+#include <chrono>
 
 #include "raven/net/Message.h"
+#include "raven/net/SlowConsumerDetector.h"
 
 
 namespace raven {
@@ -44,17 +48,57 @@ struct WSWQ_Item {
     bool cancel;
     //The message item
     std::shared_ptr<Message> msg;
+    //The priority lane of the message item
+    MessagePriority priority = MessagePriority::INTERACTIVE;
+    //The optional completion callback of the message item
+    SendCallback done = nullptr;
+    //The point in time the message item was added to the queue
+    std::chrono::steady_clock::time_point enqueued;
+
+    /**
+     * Constructs a new WSWQ_Item for the INTERACTIVE lane
+     * without a completion callback.
+     * 
+     * @param cancel Whether the item marks a cancellation signal.
+     * @param msg The message item. May be null for cancellation items.
+     */
+    WSWQ_Item(bool cancel, std::shared_ptr<Message> msg);
+
+    /**
+     * Constructs a new WSWQ_Item.
+     * 
+     * @param cancel Whether the item marks a cancellation signal.
+     * @param msg The message item. May be null for cancellation items.
+     * @param priority The priority lane of the message item.
+     * @param done The completion callback. May be null.
+     */
+    WSWQ_Item(
+        bool cancel,
+        std::shared_ptr<Message> msg,
+        MessagePriority priority,
+        SendCallback done);
 
 }; // END STRUCT WSWQ_Item
 
+//The number of priority lanes of a WebSocketWriterQueue
+static const std::size_t WSWQ_NUM_LANES = 3;
+
 /**
  * A synchronized Queue implementation for storing WSWQ_Item objects.
+ * Items are kept in one FIFO lane per MessagePriority. Items in the
+ * CONTROL lane are always returned first. The INTERACTIVE and BULK
+ * lanes are served by weighted round-robin, so that bulk traffic
+ * cannot starve interactive messages and vice versa.
  */
 class WebSocketWriterQueue {
 
     std::mutex _mutex;
     std::condition_variable _condition;
-    std::deque<WSWQ_Item> _queue;
+    std::deque<WSWQ_Item> _lanes[WSWQ_NUM_LANES];
+    std::atomic<std::size_t> _depth[WSWQ_NUM_LANES];
+    unsigned int _interactiveCredit;
+    bool _cancelled = false;
+    bool _closed = false;
 
 public:
 
@@ -65,10 +109,15 @@ public:
 
     /**
      * Adds the provided queue message to this WebSocketWriterQueue.
+     * The message is put into the lane of its priority. A cancellation
+     * item is only returned by get() after all lanes have been drained.
      * 
      * @param msg The reference to the message to be added.
+     * 
+     * @return True if the message was added, false if this
+     *         WebSocketWriterQueue has already been closed.
      */
-    void add(WSWQ_Item const& msg);
+    bool add(WSWQ_Item const& msg);
 
     /**
      * Gets the next available message and removes it
@@ -78,6 +127,56 @@ public:
      */
     WSWQ_Item get();
 
+    /**
+     * Returns the number of messages currently pending in the
+     * lane of the specified priority. This method does not block.
+     * 
+     * @param priority The priority of the lane to query.
+     * 
+     * @return The number of pending messages in the specified lane.
+     */
+    std::size_t size(MessagePriority priority) const;
+
+    /**
+     * Returns the total number of messages currently pending in
+     * all lanes of this WebSocketWriterQueue. This method does not block.
+     * 
+     * @return The number of pending messages.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the point in time the oldest pending message was added
+     * to this WebSocketWriterQueue.
+     * 
+     * @param oldest Is set to the point in time the oldest pending
+     *               message was added.
+     * 
+     * @return True if there are pending messages, false if all lanes
+     *         are empty in which case oldest is not modified.
+     */
+    bool oldest(std::chrono::steady_clock::time_point& oldest);
+
+    /**
+     * Closes this WebSocketWriterQueue. Subsequently added messages are
+     * rejected. All messages still pending are removed and returned.
+     * 
+     * @return All messages which were still pending, in lane order.
+     */
+    std::deque<WSWQ_Item> close();
+
+private:
+
+    /**
+     * Removes the front item of the specified lane.
+     * The caller must hold the queue lock.
+     * 
+     * @param lane The index of the lane to take the item from.
+     * 
+     * @return The removed WSWQ_Item.
+     */
+    WSWQ_Item _take(std::size_t lane);
+
 }; // END CLASS WebSocketWriterQueue
 
 /**
@@ -88,14 +187,18 @@ class WebSocketWriter {
     std::shared_ptr<WebSocketHandler> _handler;
     std::thread _thread;
     WebSocketWriterQueue _queue;
+    SlowConsumerDetector _lag;
     std::atomic<bool> _isRunning;
+    std::atomic<std::int64_t> _rateWindowStart;
+    std::atomic<std::uint64_t> _rateWindowCount;
+    std::atomic<double> _sendRate;
 
 public:
 
     /**
      * Constructs a WebSocketWriter for the specified WebSocketHandler.
      * The underlying thread is not started until the start() method
-     * is explicitly called.
+     * is explicitly called. Messages sent before are queued until then.
      * 
      * @param handler The WebSocketHandler to be used by the WebSocketWriter.
      */
@@ -125,16 +228,77 @@ public:
      * the underlying web socket. This method is asynchronous.
      * 
      * @param msg The message to send.
+     * @param priority The priority lane to put the message into.
      */
-    void send(std::shared_ptr<Message> msg);
+    void send(std::shared_ptr<Message> msg, MessagePriority priority);
+
+    /**
+     * Sends the specified message to the remote endpoint of
+     * the underlying web socket. This method is asynchronous.
+     * The specified callback is invoked once the message has been
+     * written, or immediately if the message was dropped. The callback
+     * may be called by the writer thread and must therefore not block.
+     * 
+     * @param msg The message to send.
+     * @param priority The priority lane to put the message into.
+     * @param done The completion callback. May be null.
+     */
+    void send(
+        std::shared_ptr<Message> msg,
+        MessagePriority priority,
+        SendCallback done);
+
+    /**
+     * Adds the specified message to the queue of this writer without
+     * calling any callback. Unlike send(), a message which is not
+     * accepted is not completed here. The caller is then responsible for
+     * calling the completion callback, e.g. after releasing its own locks.
+     * 
+     * @param msg The message to send.
+     * @param priority The priority lane to put the message into.
+     * @param done The completion callback. May be null.
+     * 
+     * @return True if the message was queued, false if it was dropped.
+     */
+    bool enqueue(
+        std::shared_ptr<Message> msg,
+        MessagePriority priority,
+        SendCallback done);
 
     /**
      * Sends the specified text message to the remote endpoint of
      * the underlying web socket. This method is asynchronous.
      * 
      * @param text The text message to send.
+     * @param priority The priority lane to put the message into.
      */
-    void sendText(const std::string& text);
+    void sendText(const std::string& text, MessagePriority priority);
+
+    /**
+     * Returns the number of messages currently pending in the
+     * queue of this WebSocketWriter.
+     * 
+     * @return The number of pending messages.
+     */
+    std::size_t getQueueDepth() const;
+
+    /**
+     * Returns the time the oldest pending message has been waiting
+     * in the queue of this WebSocketWriter.
+     * 
+     * @return The age of the oldest pending message, or zero
+     *         if no messages are pending.
+     */
+    std::chrono::milliseconds getQueueAge();
+
+    /**
+     * Returns the rate at which messages are written to the underlying
+     * web socket, measured over the most recent time window. If the writer
+     * is stalled, the rate covers the time since the last completed window.
+     * 
+     * @return The number of messages written per second.
+     */
+    double getSendRate() const;
 
 private:
 
@@ -151,6 +315,27 @@ private:
      */
     WSWQ_Item _finalizationItem();
 
+    /**
+     * Invokes the completion callback of the specified item, if any.
+     * 
+     * @param item The item whose send operation has completed.
+     * @param status The outcome of the send operation.
+     */
+    void _complete(const WSWQ_Item& item, SendStatus status);
+
+    /**
+     * Updates the send rate after a message has been written.
+     */
+    void _recordWrite();
+
+    /**
+     * Checks the queue against the slow consumer thresholds and notifies
+     * the handler when the remote endpoint starts lagging. Checking only
+     * on the writer thread keeps senders free of the queue lock and of
+     * the controller callback.
+     */
+    void _checkLag();
+
 }; // END CLASS WebSocketWriter
 
 } // END NAMESPACE net
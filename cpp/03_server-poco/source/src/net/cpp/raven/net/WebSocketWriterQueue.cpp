@@ -14,9 +14,13 @@
  * limitations under the License.
  */
 
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <deque>
+#include <utility>
+#include <chrono>
 
 #include "raven/net/WebSocketWriter.h"
 
@@ -24,25 +28,147 @@
 namespace raven {
 namespace net {
 
+using std::size_t;
+using std::shared_ptr;
 using std::unique_lock;
 using std::mutex;
+using std::deque;
+using std::chrono::steady_clock;
 
-WebSocketWriterQueue::WebSocketWriterQueue(){ }
+//Number of INTERACTIVE items served for each BULK item
+//when both lanes have pending items
+static const unsigned int WSWQ_INTERACTIVE_WEIGHT = 8;
 
-void WebSocketWriterQueue::add(WSWQ_Item const& msg){
+static const size_t LANE_CONTROL = 0;
+static const size_t LANE_INTERACTIVE = 1;
+static const size_t LANE_BULK = 2;
+
+static size_t _laneOf(MessagePriority priority){
+    switch(priority){
+    case MessagePriority::CONTROL:
+        return LANE_CONTROL;
+    case MessagePriority::BULK:
+        return LANE_BULK;
+    default:
+        return LANE_INTERACTIVE;
+    }
+}
+
+WSWQ_Item::WSWQ_Item(bool cancel, shared_ptr<Message> msg)
+    :cancel(cancel),
+     msg(msg){ }
+
+WSWQ_Item::WSWQ_Item(
+    bool cancel,
+    shared_ptr<Message> msg,
+    MessagePriority priority,
+    SendCallback done)
+    :cancel(cancel),
+     msg(msg),
+     priority(priority),
+     done(done){ }
+
+WebSocketWriterQueue::WebSocketWriterQueue()
+    :_interactiveCredit(WSWQ_INTERACTIVE_WEIGHT){
+
+    for(size_t i = 0; i < WSWQ_NUM_LANES; ++i){
+        _depth[i] = 0;
+    }
+}
+
+bool WebSocketWriterQueue::add(WSWQ_Item const& msg){
     {
         unique_lock<mutex> lock(this->_mutex);
-        _queue.push_front(msg);
+        if(_closed){
+            return false;
+        }
+        if(msg.cancel){
+            _cancelled = true;
+        }else{
+            size_t lane = _laneOf(msg.priority);
+            _lanes[lane].push_back(msg);
+            _lanes[lane].back().enqueued = steady_clock::now();
+            _depth[lane].store(_lanes[lane].size(), std::memory_order_relaxed);
+        }
     }
     this->_condition.notify_one();
+    return true;
+}
+
+WSWQ_Item WebSocketWriterQueue::_take(size_t lane){
+    WSWQ_Item rc(std::move(_lanes[lane].front()));
+    _lanes[lane].pop_front();
+    _depth[lane].store(_lanes[lane].size(), std::memory_order_relaxed);
+    return rc;
 }
 
 WSWQ_Item WebSocketWriterQueue::get(){
     unique_lock<mutex> lock(this->_mutex);
-    this->_condition.wait(lock, [=]{ return !this->_queue.empty(); });
-    WSWQ_Item rc(std::move(this->_queue.back()));
-    this->_queue.pop_back();
-    return rc;
+    this->_condition.wait(lock, [this]{
+        return this->_cancelled
+            || !this->_lanes[LANE_CONTROL].empty()
+            || !this->_lanes[LANE_INTERACTIVE].empty()
+            || !this->_lanes[LANE_BULK].empty();
+    });
+    if(!_lanes[LANE_CONTROL].empty()){
+        return _take(LANE_CONTROL);
+    }
+    const bool hasInteractive = !_lanes[LANE_INTERACTIVE].empty();
+    const bool hasBulk = !_lanes[LANE_BULK].empty();
+    if(hasInteractive && (_interactiveCredit > 0 || !hasBulk)){
+        if(_interactiveCredit > 0){
+            --_interactiveCredit;
+        }
+        return _take(LANE_INTERACTIVE);
+    }
+    if(hasBulk){
+        _interactiveCredit = WSWQ_INTERACTIVE_WEIGHT;
+        return _take(LANE_BULK);
+    }
+    //All lanes are drained and cancellation was requested
+    return WSWQ_Item{true, nullptr};
+}
+
+size_t WebSocketWriterQueue::size(MessagePriority priority) const{
+    return _depth[_laneOf(priority)].load(std::memory_order_relaxed);
+}
+
+size_t WebSocketWriterQueue::size() const{
+    size_t total = 0;
+    for(size_t i = 0; i < WSWQ_NUM_LANES; ++i){
+        total += _depth[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+bool WebSocketWriterQueue::oldest(steady_clock::time_point& oldest){
+    unique_lock<mutex> lock(this->_mutex);
+    bool found = false;
+    for(size_t i = 0; i < WSWQ_NUM_LANES; ++i){
+        if(!_lanes[i].empty()){
+            //Lanes are FIFO, so the front item is the oldest of each lane
+            const steady_clock::time_point t = _lanes[i].front().enqueued;
+            if(!found || t < oldest){
+                oldest = t;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+deque<WSWQ_Item> WebSocketWriterQueue::close(){
+    unique_lock<mutex> lock(this->_mutex);
+    _closed = true;
+    deque<WSWQ_Item> remaining;
+    for(size_t i = 0; i < WSWQ_NUM_LANES; ++i){
+        for(WSWQ_Item& item : _lanes[i]){
+            remaining.push_back(std::move(item));
+        }
+        _lanes[i].clear();
+        _depth[i].store(0, std::memory_order_relaxed);
+    }
+    return remaining;
 }
 
 } // END NAMESPACE net
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+#include "raven/util/WorkerPool.h"
+#include "raven/util/Log.h"
+
+
+namespace raven {
+namespace util {
+
+using std::size_t;
+using std::thread;
+using std::function;
+using std::unique_lock;
+using std::mutex;
+
+WorkerPool::WorkerPool(size_t size){
+    if(size == 0){
+        size = thread::hardware_concurrency();
+    }
+    if(size == 0){
+        size = 1;
+    }
+    for(size_t i = 0; i < size; ++i){
+        _threads.emplace_back(&WorkerPool::_workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool(){
+    stop();
+}
+
+void WorkerPool::_workerLoop(){
+    while(true){
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(_mutex);
+            _condition.wait(lock, [this]{
+                return !_isRunning || !_tasks.empty();
+            });
+            if(_tasks.empty()){
+                //Stopped and drained
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        try{
+            task();
+        }catch(const std::exception& ex){
+            Log::error("WorkerPool: Task has thrown uncaught exception");
+        }catch(...){
+            Log::error("WorkerPool: Task has thrown unknown error");
+        }
+    }
+}
+
+void WorkerPool::submit(function<void()> task){
+    {
+        unique_lock<mutex> lock(_mutex);
+        if(!_isRunning){
+            return;
+        }
+        _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+}
+
+void WorkerPool::stop(){
+    {
+        unique_lock<mutex> lock(_mutex);
+        if(!_isRunning){
+            return;
+        }
+        _isRunning = false;
+    }
+    _condition.notify_all();
+    for(thread& t : _threads){
+        if(t.joinable()){
+            t.join();
+        }
+    }
+}
+
+} // END NAMESPACE util
+} // END NAMESPACE raven
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_UTIL_WORKER_POOL_H
+#define RAVEN_UTIL_WORKER_POOL_H
+
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+
+namespace raven {
+namespace util {
+
+/**
+ * A fixed-size pool of worker threads executing submitted tasks
+ * in FIFO order.
+ * 
+ * All methods of this class are thread-safe.
+ */
+class WorkerPool {
+
+    std::vector<std::thread> _threads;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _isRunning = true;
+
+public:
+
+    /**
+     * Constructs a new WorkerPool and starts the specified
+     * number of worker threads.
+     * 
+     * @param size The number of worker threads. If zero, the number of
+     *             hardware threads is used.
+     */
+    WorkerPool(std::size_t size);
+
+    WorkerPool(WorkerPool const&) = delete;
+
+    void operator=(WorkerPool const&) = delete;
+
+    /**
+     * Stops all worker threads. See stop().
+     */
+    ~WorkerPool();
+
+    /**
+     * Submits the specified task for execution by one of the
+     * worker threads. Tasks submitted after the pool has been
+     * stopped are discarded.
+     * 
+     * @param task The task to execute.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * Stops all worker threads. Pending tasks are still executed.
+     * This method blocks until all worker threads have terminated.
+     * Repeated calls have no effect.
+     */
+    void stop();
+
+private:
+
+    /**
+     * Worker thread loop implementation.
+     */
+    void _workerLoop();
+
+}; // END CLASS WorkerPool
+
+} // END NAMESPACE util
+} // END NAMESPACE raven
+
+#endif // RAVEN_UTIL_WORKER_POOL_H
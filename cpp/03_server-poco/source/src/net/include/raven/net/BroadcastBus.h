@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_BROADCAST_BUS_H
+#define RAVEN_NET_BROADCAST_BUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <shared_mutex>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * A host-local bus for broadcasting web socket messages across all server
+ * processes running on the same machine. All processes using a BroadcastBus
+ * with the same name map the same shared memory region, which is organized
+ * as a fixed-size ring of message slots. Any process can publish messages
+ * into the ring. Each process runs a reader thread which picks up messages
+ * published by other processes and delivers them to its local sessions.
+ * 
+ * A published message is addressed either to all sessions or to the
+ * members of a group (see SessionGroups). Messages published by a process
+ * are delivered to its own local sessions directly, without a round trip
+ * through the shared memory region.
+ * 
+ * Readers which fall behind by more than the number of slots in the ring
+ * skip the overwritten messages. Such messages are counted as lost.
+ * All processes must use the same slot count and slot size for a bus name.
+ * 
+ * The shared memory region is created by the first process which starts
+ * a bus with a given name and is removed by the last process which stops it.
+ * 
+ * A BroadcastBus is usually provided to a server via
+ * ServerTCP::broadcastBus(), which starts and stops it together
+ * with the server. All methods of this class are thread-safe.
+ */
+class BroadcastBus {
+
+    const std::string _name;
+    const std::size_t _slotCount;
+    const std::size_t _slotSize;
+    const std::uint64_t _origin;
+
+    int _fd = -1;
+    char* _memory = nullptr;
+    std::size_t _size = 0;
+    char* _slots = nullptr;
+    std::size_t _stride = 0;
+    std::uint64_t _cursor = 0;
+    std::atomic<bool> _isRunning;
+    std::atomic<std::uint64_t> _lost;
+    std::thread _reader;
+    std::shared_mutex _mutex;
+
+public:
+
+    /**
+     * The default number of slots of the ring.
+     */
+    static const std::size_t DEFAULT_SLOT_COUNT = 4096;
+
+    /**
+     * The default maximum size of a single message in bytes, including
+     * the name of the group it is addressed to.
+     */
+    static const std::size_t DEFAULT_SLOT_SIZE = 4096;
+
+    /**
+     * Constructs a new BroadcastBus with the specified name, using
+     * the default slot count and slot size.
+     * 
+     * @param name The name of the bus. All processes using the same
+     *             name share the same bus. Must not contain a slash.
+     */
+    BroadcastBus(const std::string& name);
+
+    /**
+     * Constructs a new BroadcastBus with the specified name,
+     * slot count and slot size.
+     * 
+     * @param name The name of the bus. All processes using the same
+     *             name share the same bus. Must not contain a slash.
+     * @param slotCount The number of slots of the ring. Must be a
+     *                  power of two.
+     * @param slotSize The maximum size of a single message in bytes,
+     *                 including the name of the group it is addressed to.
+     */
+    BroadcastBus(
+        const std::string& name,
+        std::size_t slotCount,
+        std::size_t slotSize);
+
+    BroadcastBus(BroadcastBus const&) = delete;
+
+    void operator=(BroadcastBus const&) = delete;
+
+    /**
+     * Stops this bus. See stop().
+     */
+    virtual ~BroadcastBus();
+
+    /**
+     * Maps the shared memory region of this bus and starts the reader
+     * thread. The region is created if no other process uses it.
+     * Only messages published after this call are delivered.
+     * Repeated calls have no effect.
+     * 
+     * @throws runtime_error If the shared memory region cannot be used.
+     */
+    void start();
+
+    /**
+     * Stops the reader thread and unmaps the shared memory region.
+     * The region is removed if no other process uses it anymore,
+     * otherwise it remains available to the other processes.
+     * Repeated calls have no effect.
+     */
+    void stop();
+
+    /**
+     * Indicates whether this bus is started.
+     * 
+     * @return True if this bus is started, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * Publishes the specified message to all sessions of all processes.
+     * 
+     * @param message The string message to publish.
+     * 
+     * @return True if the message was published, false if this bus
+     *         is not started, if the message does not fit into a slot or
+     *         if the slot is still held by a writer which does not finish.
+     */
+    bool publish(const std::string& message);
+
+    /**
+     * Publishes the specified message to all members of the specified
+     * group in all processes.
+     * 
+     * @param group The name of the group.
+     * @param message The string message to publish.
+     * 
+     * @return True if the message was published, false if this bus
+     *         is not started, if the message does not fit into a slot or
+     *         if the slot is still held by a writer which does not finish.
+     */
+    bool publish(const std::string& group, const std::string& message);
+
+    /**
+     * Returns the number of messages which the reader thread of this
+     * process has skipped because it fell behind.
+     * 
+     * @return The number of lost messages.
+     */
+    std::uint64_t getLostMessages() const;
+
+    /**
+     * Returns the name of this bus.
+     * 
+     * @return The name of this bus.
+     */
+    std::string getName() const;
+
+protected:
+
+    /**
+     * Delivers the specified message to the local sessions of this process.
+     * This method is called for messages published by this process and
+     * from the reader thread for messages published by other processes.
+     * By default, the message is sent to all sessions or to the members
+     * of the addressed group. Subclasses which override this method must
+     * call stop() in their destructor.
+     * 
+     * @param group The name of the group, or empty for all sessions.
+     * @param message The string message.
+     */
+    virtual void deliver(const std::string& group, const std::string& message);
+
+private:
+
+    /**
+     * Writes the specified message into the next slot of the ring.
+     * 
+     * @param group The name of the group, or empty for all sessions.
+     * @param message The string message.
+     * 
+     * @return True if the message was written or if its slot was already
+     *         claimed by a newer message, false if the slot could not be
+     *         claimed.
+     */
+    bool _write(const std::string& group, const std::string& message);
+
+    /**
+     * Opens and maps the shared memory region of this bus, creating
+     * it if necessary, and takes a shared lock on it.
+     * 
+     * @throws runtime_error If the shared memory region cannot be used.
+     */
+    void _open();
+
+    /**
+     * Unmaps the shared memory region of this bus and removes
+     * it if no other process holds a lock on it.
+     */
+    void _close();
+
+    /**
+     * Blocks the reader thread until another message might be
+     * available or until this bus is stopped.
+     * 
+     * @param signal The value of the signal counter which was observed
+     *               before the reader found no message.
+     */
+    void _await(std::uint32_t signal);
+
+    /**
+     * Reader thread loop implementation.
+     */
+    void _readerLoop();
+
+}; // END CLASS BroadcastBus
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_BROADCAST_BUS_H
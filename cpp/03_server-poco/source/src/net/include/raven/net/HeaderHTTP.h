@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_HEADER_HTTP_H
+#define RAVEN_NET_HEADER_HTTP_H
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Enumeration of well-known HTTP request headers. Headers listed here
+ * can be accessed through RequestHTTP::getHeader(HeaderHTTP) without
+ * a lookup by name.
+ */
+enum class HeaderHTTP {
+    ACCEPT,
+    ACCEPT_ENCODING,
+    ACCEPT_LANGUAGE,
+    AUTHORIZATION,
+    CACHE_CONTROL,
+    CONNECTION,
+    CONTENT_ENCODING,
+    CONTENT_LENGTH,
+    CONTENT_TYPE,
+    COOKIE,
+    HOST,
+    IF_MODIFIED_SINCE,
+    IF_NONE_MATCH,
+    ORIGIN,
+    RANGE,
+    REFERER,
+    SEC_WEBSOCKET_KEY,
+    SEC_WEBSOCKET_PROTOCOL,
+    SEC_WEBSOCKET_VERSION,
+    TRANSFER_ENCODING,
+    UPGRADE,
+    USER_AGENT,
+    X_FORWARDED_FOR,
+    X_REQUEST_ID
+};
+
+/**
+ * The number of constants of the HeaderHTTP enumeration.
+ */
+static const std::size_t HEADER_HTTP_COUNT =
+    static_cast<std::size_t>(HeaderHTTP::X_REQUEST_ID) + 1;
+
+/**
+ * Determines the well-known header with the specified name.
+ * Header names are case-insensitive.
+ * 
+ * @param name The name of the header, e.g. "Content-Type".
+ * @param header The HeaderHTTP to set if the name denotes
+ *               a well-known header.
+ * 
+ * @return True if the name denotes a well-known header,
+ *         false otherwise.
+ */
+bool parseHeaderHTTP(std::string_view name, HeaderHTTP& header);
+
+/**
+ * Returns the canonical name of the specified header.
+ * 
+ * @param header The header to get the name of.
+ * 
+ * @return The name of the header, e.g. "Content-Type".
+ */
+std::string_view toString(HeaderHTTP header);
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_HEADER_HTTP_H
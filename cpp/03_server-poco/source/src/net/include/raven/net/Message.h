@@ -17,21 +17,70 @@
 #ifndef RAVEN_NET_MESSAGE_H
 #define RAVEN_NET_MESSAGE_H
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <functional>
 
 
 namespace raven {
 namespace net {
 
+/**
+ * Enumeration for all supported priorities of outbound messages.
+ * Each priority is served by its own lane in the outbound queue
+ * of a web socket session. CONTROL messages, e.g. pings and pongs, are
+ * always written first, whereas INTERACTIVE and BULK messages share the
+ * remaining capacity in a weighted manner, favouring INTERACTIVE messages.
+ */
+enum class MessagePriority {
+    CONTROL,
+    INTERACTIVE,
+    BULK
+};
+
+/**
+ * Enumeration for all possible outcomes of sending an outbound message.
+ */
+enum class SendStatus {
+    //The message was written to the underlying socket
+    WRITTEN,
+    //The session is disconnected but the message was kept for replay
+    BUFFERED,
+    //The message was discarded because the session is closed
+    DROPPED,
+    //Writing the message to the underlying socket has failed
+    FAILED
+};
+
+/**
+ * Callback type for the completion of an asynchronous send operation.
+ * The first argument is the outcome of the send operation, the second
+ * argument is the number of messages still pending in the outbound queue
+ * of the session at the time the callback is invoked.
+ */
+typedef std::function<void(SendStatus, std::size_t)> SendCallback;
+
+/**
+ * Callback type for the progress of a send operation which is split
+ * into multiple messages. The first argument is the number of bytes
+ * written so far, the second argument is the total number of bytes.
+ */
+typedef std::function<void(std::size_t, std::size_t)> ProgressCallback;
+
 /**
  * Represents all messages which can be exchanged via
- * web socket connections. Currently, only text
- * messages are supported.
+ * web socket connections. The content of a binary message is
+ * held in the same way as the content of a text message and
+ * can be accessed via getText(). Binary content can be decoded
+ * in place, e.g. with a MessagePackDecoder.
  */
 class Message {
 
     std::string _text;
     int _type;
+    std::shared_ptr<const char> _data;
+    std::size_t _size = 0;
 
 public:
 
@@ -39,7 +88,7 @@ public:
      * Constructs a new empty Message of the given type.
      * 
      * @param type The type of the Message.
-     *             1 = text, 2 = ping, 3 = pong.
+     *             1 = text, 2 = ping, 3 = pong, 4 = binary.
      */
     Message(int type);
 
@@ -55,18 +104,57 @@ public:
      * and the specified type.
      * 
      * @param type The type of the Message.
-     *             1 = text, 2 = ping, 3 = pong.
+     *             1 = text, 2 = ping, 3 = pong, 4 = binary.
      * @param text The text content of the Message.
      */
     Message(int type, const std::string& text);
 
     /**
-     * Gets the text content of this Message.
+     * Constructs a new Message with the given content and the specified
+     * type. The content is moved into the Message without copying.
+     * 
+     * @param type The type of the Message.
+     *             1 = text, 2 = ping, 3 = pong, 4 = binary.
+     * @param text The content of the Message.
+     */
+    Message(int type, std::string&& text);
+
+    /**
+     * Constructs a new Message of the specified type whose content is
+     * held externally, e.g. in a memory-mapped file. The content is not
+     * copied. The specified pointer keeps the underlying memory alive
+     * for as long as the Message exists.
+     * 
+     * @param type The type of the Message.
+     *             1 = text, 2 = ping, 3 = pong, 4 = binary.
+     * @param data The pointer to the first byte of the content.
+     * @param size The size of the content in bytes.
+     */
+    Message(int type, std::shared_ptr<const char> data, std::size_t size);
+
+    /**
+     * Gets the text content of this Message. The text content is
+     * empty if the content of this Message is held externally.
      * 
      * @return The text content of this Message.
      */
     const std::string& getText();
 
+    /**
+     * Gets a pointer to the content of this Message, regardless of
+     * whether the content is held internally or externally.
+     * 
+     * @return A pointer to the first byte of the content.
+     */
+    const char* getData();
+
+    /**
+     * Gets the size of the content of this Message.
+     * 
+     * @return The size of the content in bytes.
+     */
+    std::size_t getSize();
+
     /**
      * Indicates whether this Message is a text message.
      * 
@@ -75,6 +163,14 @@ public:
      */
     bool isText();
 
+    /**
+     * Indicates whether this Message is a binary message.
+     * 
+     * @return True if this Message represents a regular web socket
+     *         binary message, false otherwise.
+     */
+    bool isBinary();
+
     /**
      * Indicates whether this Message is a Ping message.
      * 
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_MESSAGE_PACK_DECODER_H
+#define RAVEN_NET_MESSAGE_PACK_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Enumeration for all types of values in the MessagePack format.
+ */
+enum class MessagePackType {
+    NIL,
+    BOOLEAN,
+    INTEGER,
+    FLOAT,
+    STRING,
+    BINARY,
+    ARRAY,
+    MAP,
+    EXTENSION
+};
+
+/**
+ * Decodes values in the MessagePack binary format. This is a pull
+ * decoder which reads one value at a time from the underlying data.
+ * Strings and binary values are returned as views into the underlying
+ * data and are therefore only valid as long as the data is, e.g. for the
+ * duration of WebSocketController::onMessageReceived() when decoding
+ * the content of a received binary Message.
+ * 
+ * All read methods throw a runtime_error if the next value has
+ * a different type or if the data is truncated or malformed. The read
+ * position is not changed by a read method that throws.
+ */
+class MessagePackDecoder {
+
+    std::string_view _data;
+    std::size_t _pos;
+
+public:
+
+    /**
+     * Constructs a new MessagePackDecoder for the specified data.
+     * The data is not copied.
+     * 
+     * @param data The MessagePack data to decode.
+     */
+    MessagePackDecoder(std::string_view data);
+
+    /**
+     * Indicates whether there are more values to decode.
+     * 
+     * @return True if not all data has been decoded yet.
+     */
+    bool hasNext() const;
+
+    /**
+     * Gets the type of the next value without consuming it.
+     * 
+     * @return The type of the next value.
+     */
+    MessagePackType peekType() const;
+
+    /**
+     * Consumes a nil value.
+     */
+    void readNil();
+
+    /**
+     * Reads a boolean value.
+     * 
+     * @return The decoded value.
+     */
+    bool readBool();
+
+    /**
+     * Reads an integer value which must be representable
+     * as a signed 64-bit integer.
+     * 
+     * @return The decoded value.
+     */
+    std::int64_t readInt();
+
+    /**
+     * Reads an integer value which must be representable
+     * as an unsigned 64-bit integer.
+     * 
+     * @return The decoded value.
+     */
+    std::uint64_t readUInt();
+
+    /**
+     * Reads a floating point value. Integer values
+     * are converted as well.
+     * 
+     * @return The decoded value.
+     */
+    double readDouble();
+
+    /**
+     * Reads a string value without copying it.
+     * 
+     * @return A view of the string in the underlying data.
+     */
+    std::string_view readString();
+
+    /**
+     * Reads a binary value without copying it.
+     * 
+     * @return A view of the bytes in the underlying data.
+     */
+    std::string_view readBinary();
+
+    /**
+     * Reads the header of an array. The elements of the
+     * array are the subsequent values.
+     * 
+     * @return The number of elements of the array.
+     */
+    std::uint32_t readArrayHeader();
+
+    /**
+     * Reads the header of a map. The entries of the map are the
+     * subsequent values, alternating between key and value.
+     * 
+     * @return The number of entries of the map.
+     */
+    std::uint32_t readMapHeader();
+
+    /**
+     * Skips the next value. Arrays and maps are skipped
+     * including all their elements.
+     */
+    void skip();
+
+    /**
+     * Gets the current read position in the underlying data.
+     * 
+     * @return The number of bytes consumed so far.
+     */
+    std::size_t getPosition() const;
+
+private:
+
+    /**
+     * Returns the marker byte of the next value without consuming it.
+     */
+    std::uint8_t _peek() const;
+
+    /**
+     * Consumes the specified number of bytes as a big-endian
+     * unsigned integer. If the data is truncated, the read position
+     * is reset to the specified start of the value before throwing.
+     */
+    std::uint64_t _take(std::size_t length, std::size_t start);
+
+    /**
+     * Consumes the specified number of bytes and returns them as a view.
+     * If the data is truncated, the read position is reset to the
+     * specified start of the value before throwing.
+     */
+    std::string_view _view(std::size_t length, std::size_t start);
+
+    /**
+     * Consumes an integer value.
+     * 
+     * @param isSigned Is set to true if the value was encoded
+     *                 as a signed integer.
+     * 
+     * @return The raw value, to be interpreted as int64_t
+     *         if isSigned is true.
+     */
+    std::uint64_t _readInteger(bool& isSigned);
+
+}; // END CLASS MessagePackDecoder
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_MESSAGE_PACK_DECODER_H
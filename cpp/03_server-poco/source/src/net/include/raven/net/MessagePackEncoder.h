@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_MESSAGE_PACK_ENCODER_H
+#define RAVEN_NET_MESSAGE_PACK_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Encodes values in the MessagePack binary format. All values are
+ * appended to an internal buffer, which can be moved into an outbound
+ * binary message via release() without copying, e.g.
+ * session.sendBinary(encoder.release()).
+ * 
+ * Arrays and maps are encoded by writing a header with the number of
+ * elements, followed by the elements themselves. For maps, each entry
+ * consists of a key followed by its value.
+ */
+class MessagePackEncoder {
+
+    std::string _buffer;
+
+public:
+
+    /**
+     * Constructs a new MessagePackEncoder with an empty buffer.
+     */
+    MessagePackEncoder();
+
+    /**
+     * Constructs a new MessagePackEncoder and reserves the specified
+     * number of bytes in its buffer.
+     * 
+     * @param capacity The number of bytes to reserve.
+     */
+    MessagePackEncoder(std::size_t capacity);
+
+    /**
+     * Encodes a nil value.
+     */
+    void writeNil();
+
+    /**
+     * Encodes the specified boolean value.
+     * 
+     * @param value The value to encode.
+     */
+    void writeBool(bool value);
+
+    /**
+     * Encodes the specified signed integer value, using
+     * the smallest possible representation.
+     * 
+     * @param value The value to encode.
+     */
+    void writeInt(std::int64_t value);
+
+    /**
+     * Encodes the specified unsigned integer value, using
+     * the smallest possible representation.
+     * 
+     * @param value The value to encode.
+     */
+    void writeUInt(std::uint64_t value);
+
+    /**
+     * Encodes the specified value as a 32-bit floating point number.
+     * 
+     * @param value The value to encode.
+     */
+    void writeFloat(float value);
+
+    /**
+     * Encodes the specified value as a 64-bit floating point number.
+     * 
+     * @param value The value to encode.
+     */
+    void writeDouble(double value);
+
+    /**
+     * Encodes the specified UTF-8 string.
+     * 
+     * @param value The string to encode.
+     */
+    void writeString(std::string_view value);
+
+    /**
+     * Encodes the specified bytes as a binary value.
+     * 
+     * @param value The bytes to encode.
+     */
+    void writeBinary(std::string_view value);
+
+    /**
+     * Encodes the header of an array with the specified number
+     * of elements. The elements must be written subsequently.
+     * 
+     * @param size The number of elements of the array.
+     */
+    void writeArrayHeader(std::uint32_t size);
+
+    /**
+     * Encodes the header of a map with the specified number of
+     * entries. The keys and values must be written subsequently,
+     * alternating between key and value.
+     * 
+     * @param size The number of entries of the map.
+     */
+    void writeMapHeader(std::uint32_t size);
+
+    /**
+     * Gets the encoded data.
+     * 
+     * @return The buffer holding all encoded values.
+     */
+    const std::string& getData() const;
+
+    /**
+     * Gets the number of encoded bytes.
+     * 
+     * @return The size of the encoded data in bytes.
+     */
+    std::size_t size() const;
+
+    /**
+     * Removes all encoded data from this encoder.
+     */
+    void clear();
+
+    /**
+     * Moves the encoded data out of this encoder.
+     * The encoder is empty afterwards.
+     * 
+     * @return The buffer holding all encoded values.
+     */
+    std::string release();
+
+private:
+
+    /**
+     * Appends the specified marker byte followed by the
+     * specified number of bytes of the value in big-endian order.
+     * 
+     * @param marker The MessagePack marker byte.
+     * @param value The value to append.
+     * @param length The number of bytes of the value to append.
+     */
+    void _put(std::uint8_t marker, std::uint64_t value, std::size_t length);
+
+}; // END CLASS MessagePackEncoder
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_MESSAGE_PACK_ENCODER_H
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_METHOD_HTTP_H
+#define RAVEN_NET_METHOD_HTTP_H
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Enumeration of all HTTP request methods known to the router.
+ */
+enum class MethodHTTP {
+    HTTP_GET,
+    HTTP_HEAD,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_DELETE,
+    HTTP_PATCH,
+    HTTP_OPTIONS,
+    HTTP_CONNECT,
+    HTTP_TRACE,
+    //Any method not listed above
+    HTTP_OTHER
+};
+
+/**
+ * The number of constants of the MethodHTTP enumeration.
+ */
+static const std::size_t METHOD_HTTP_COUNT =
+    static_cast<std::size_t>(MethodHTTP::HTTP_OTHER) + 1;
+
+/**
+ * Parses the specified HTTP method name. Method names are case-sensitive.
+ * 
+ * @param method The name of the method, e.g. "GET".
+ * 
+ * @return The corresponding MethodHTTP, or MethodHTTP::HTTP_OTHER
+ *         if the name does not denote a known method.
+ */
+MethodHTTP parseMethodHTTP(std::string_view method);
+
+/**
+ * Returns the name of the specified HTTP method.
+ * 
+ * @param method The method to get the name of.
+ * 
+ * @return The name of the method, e.g. "GET", or an empty view
+ *         for MethodHTTP::HTTP_OTHER.
+ */
+std::string_view toString(MethodHTTP method);
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_METHOD_HTTP_H
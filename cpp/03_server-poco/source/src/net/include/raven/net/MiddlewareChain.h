@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_MIDDLEWARE_CHAIN_H
+#define RAVEN_NET_MIDDLEWARE_CHAIN_H
+
+#include <cstddef>
+#include <functional>
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+//Forward declarations
+class BasicRouterHTTP;
+class MiddlewareChain;
+
+/**
+ * A function which intercepts every request routed by a BasicRouterHTTP.
+ * A middleware passes the request on by calling proceed() on the
+ * specified chain, and can act on the response after that call returns.
+ * A middleware which does not call proceed() short-circuits the request,
+ * in which case it is responsible for producing the response.
+ */
+typedef std::function<void(RequestHTTP&, ResponseHTTP&, MiddlewareChain&)>
+        Middleware;
+
+/**
+ * The position of a request within the middleware of a router.
+ * A MiddlewareChain is created on the stack for every routed request,
+ * so passing a request through the middleware does not allocate.
+ */
+class MiddlewareChain {
+
+    friend class BasicRouterHTTP;
+
+    BasicRouterHTTP& _router;
+    std::size_t _next;
+
+    MiddlewareChain(BasicRouterHTTP& router);
+
+public:
+
+    MiddlewareChain(MiddlewareChain const&) = delete;
+
+    void operator=(MiddlewareChain const&) = delete;
+
+    /**
+     * Passes the request to the next middleware, or routes it to
+     * the responsible controller if all middleware has been passed.
+     * A middleware must call this method at most once.
+     * 
+     * @param request A reference to the RequestHTTP object to pass on.
+     * @param response A reference to the ResponseHTTP object to pass on.
+     */
+    void proceed(RequestHTTP& request, ResponseHTTP& response);
+
+}; // END CLASS MiddlewareChain
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_MIDDLEWARE_CHAIN_H
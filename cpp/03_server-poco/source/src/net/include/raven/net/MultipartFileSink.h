@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_MULTIPART_FILE_SINK_H
+#define RAVEN_NET_MULTIPART_FILE_SINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+
+#include "Poco/Net/NameValueCollection.h"
+
+#include "raven/net/MultipartParser.h"
+
+
+namespace raven {
+namespace net {
+
+//The default maximum size of a regular form field, in bytes
+static const std::size_t MFS_DEFAULT_MAX_FIELD_SIZE = 65536;
+
+/**
+ * A file received as a part of a multipart/form-data body.
+ */
+struct MultipartFile {
+
+    /**
+     * The headers of the part which contained the file.
+     */
+    MultipartPart part;
+
+    /**
+     * The path of the file the content of the part was written to.
+     */
+    std::string path;
+
+    /**
+     * The size of the file, in bytes.
+     */
+    std::uint64_t size = 0;
+
+}; // END STRUCT MultipartFile
+
+/**
+ * A MultipartHandler which writes the content of all file parts
+ * straight to disk, as it is read from the request. Regular form fields
+ * are collected in memory, up to a maximum size per field.
+ * 
+ * Each file part is written to a new file with a unique, generated name
+ * within the directory of the sink. The file name specified by the client
+ * is never used as a path but is available through the MultipartPart of
+ * each received file. The written files are owned by the caller, who is
+ * responsible for moving or removing them. If parsing fails, all files
+ * written by the sink are removed.
+ */
+class MultipartFileSink : public MultipartHandler {
+
+    const std::string _directory;
+    const std::size_t _maxFieldSize;
+    std::vector<MultipartFile> _files;
+    Poco::Net::NameValueCollection _fields;
+    std::ofstream _out;
+    MultipartPart _part;
+    std::string _value;
+
+public:
+
+    /**
+     * Constructs a new MultipartFileSink which writes
+     * files to the specified directory. Form fields may have
+     * up to MFS_DEFAULT_MAX_FIELD_SIZE bytes.
+     * 
+     * @param directory The path of an existing directory to write files to.
+     */
+    MultipartFileSink(const std::string& directory);
+
+    /**
+     * Constructs a new MultipartFileSink which writes
+     * files to the specified directory.
+     * 
+     * @param directory The path of an existing directory to write files to.
+     * @param maxFieldSize The maximum size of a regular form field, in bytes.
+     */
+    MultipartFileSink(const std::string& directory, std::size_t maxFieldSize);
+
+    MultipartFileSink(MultipartFileSink const&) = delete;
+
+    void operator=(MultipartFileSink const&) = delete;
+
+    /**
+     * Creates the file for a file part, or prepares
+     * the value of a regular form field.
+     * 
+     * @param part The headers of the part.
+     * 
+     * @throws runtime_error If the file cannot be created.
+     */
+    void onPartBegin(const MultipartPart& part) override;
+
+    /**
+     * Writes the specified chunk to the file of the current file part,
+     * or appends it to the value of the current form field.
+     * 
+     * @param data A view of the chunk.
+     * 
+     * @throws runtime_error If the file cannot be written or if
+     *                       a form field exceeds its maximum size.
+     */
+    void onPartData(std::string_view data) override;
+
+    /**
+     * Closes the file of the current file part, or adds the
+     * value of the current form field to the form fields.
+     * 
+     * @throws runtime_error If the file cannot be written.
+     */
+    void onPartEnd() override;
+
+    /**
+     * Removes all files written by this sink.
+     */
+    void onAbort() override;
+
+    /**
+     * Gets all files received by this sink, in the
+     * order in which they appeared in the body.
+     * 
+     * @return The received files.
+     */
+    const std::vector<MultipartFile>& getFiles() const;
+
+    /**
+     * Gets all regular form fields received by this sink.
+     * 
+     * @return The received form fields, by field name.
+     */
+    Poco::Net::NameValueCollection& getFields();
+
+    /**
+     * Removes all files written by this sink from disk. The
+     * list returned by getFiles() is empty afterwards.
+     */
+    void removeFiles();
+
+private:
+
+    /**
+     * Creates a unique path for a new file within the directory of this sink.
+     * 
+     * @return The path of the new file.
+     */
+    std::string _createPath() const;
+
+}; // END CLASS MultipartFileSink
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_MULTIPART_FILE_SINK_H
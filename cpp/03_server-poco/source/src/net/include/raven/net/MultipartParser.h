@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_MULTIPART_PARSER_H
+#define RAVEN_NET_MULTIPART_PARSER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <functional>
+
+#include "raven/net/RequestHTTP.h"
+
+
+namespace raven {
+namespace net {
+
+//The size of the buffer used to read a request body, in bytes
+static const std::size_t MP_READ_BUFFER_SIZE = 65536;
+
+//The maximum total size of the header lines of a single part, in bytes
+static const std::size_t MP_MAX_HEADER_SIZE = 16384;
+
+//The maximum length of a boundary, as specified by RFC 2046
+static const std::size_t MP_MAX_BOUNDARY_LENGTH = 70;
+
+/**
+ * The headers of a single part of a multipart/form-data body.
+ */
+struct MultipartPart {
+
+    /**
+     * The name of the form field, as specified by
+     * the Content-Disposition header of the part.
+     */
+    std::string name;
+
+    /**
+     * The file name specified by the client, as specified by the
+     * Content-Disposition header of the part. Empty if the part
+     * is a regular form field instead of a file.
+     * The file name is not sanitized in any way and must
+     * not be used as a file system path without validation.
+     */
+    std::string filename;
+
+    /**
+     * The value of the Content-Type header of the part.
+     * Empty if the part does not specify a content type.
+     */
+    std::string contentType;
+
+}; // END STRUCT MultipartPart
+
+/**
+ * Handler interface for the parts of a multipart/form-data body.
+ * Users should inherit from this class and implement the needed methods.
+ * The methods are called by a MultipartParser in the order in which the
+ * parts appear in the body.
+ */
+class MultipartHandler {
+
+public:
+
+    virtual ~MultipartHandler();
+
+    /**
+     * This method is called when the headers of a part have been read,
+     * before any of the content of the part is passed to onPartData().
+     * 
+     * @param part The headers of the part.
+     */
+    virtual void onPartBegin(const MultipartPart& part);
+
+    /**
+     * This method is called for each chunk of the content of the current
+     * part, as it is read from the request. The content of a part may be
+     * split into an arbitrary number of chunks.
+     * 
+     * @param data A view of the chunk. The view is only valid
+     *             until this method returns.
+     */
+    virtual void onPartData(std::string_view data);
+
+    /**
+     * This method is called when the entire content of
+     * the current part has been passed to onPartData().
+     */
+    virtual void onPartEnd();
+
+    /**
+     * This method is called by MultipartParser::parse() when the body
+     * cannot be parsed completely, e.g. because it is malformed, too large
+     * or because one of the other methods has thrown an exception.
+     * Implementations should release any resources held for
+     * the parts received so far.
+     */
+    virtual void onAbort();
+
+}; // END CLASS MultipartHandler
+
+/**
+ * Incremental parser for multipart/form-data bodies, as specified by
+ * RFC 7578. The body is fed to the parser in chunks of arbitrary size
+ * and the parts are passed on to a MultipartHandler as they are
+ * encountered, without ever buffering an entire part. The memory used
+ * by a parser is therefore bounded by the size of the fed chunks,
+ * regardless of the size of the body.
+ * 
+ * Use the static MultipartParser::parse() method to parse
+ * the body of a RequestHTTP directly from the request stream.
+ */
+class MultipartParser {
+
+    /**
+     * The states of a parser.
+     */
+    enum class State {
+        PREAMBLE,
+        DELIMITER,
+        HEADERS,
+        BODY,
+        DONE
+    };
+
+    MultipartHandler& _handler;
+    const std::string _delimiter;
+    const std::boyer_moore_horspool_searcher<const char*> _searcher;
+    std::string _buffer;
+    State _state = State::PREAMBLE;
+    MultipartPart _part;
+    std::size_t _headerSize = 0;
+
+public:
+
+    /**
+     * Constructs a new MultipartParser for a body with the specified
+     * boundary, passing all parts to the specified handler.
+     * 
+     * @param boundary The boundary of the multipart body.
+     * @param handler The MultipartHandler to pass the parts to. The handler
+     *                must outlive the constructed parser.
+     * 
+     * @throws runtime_error If the boundary is empty or too long.
+     */
+    MultipartParser(const std::string& boundary, MultipartHandler& handler);
+
+    MultipartParser(MultipartParser const&) = delete;
+
+    void operator=(MultipartParser const&) = delete;
+
+    /**
+     * Feeds the next chunk of the body to this parser. The parts contained
+     * in the chunk are passed to the handler before this method returns.
+     * Only the end of the chunk that might be the beginning of a boundary
+     * is retained by the parser until the next chunk is fed.
+     * 
+     * @param data A pointer to the chunk.
+     * @param size The size of the chunk, in bytes.
+     * 
+     * @throws runtime_error If the body is malformed.
+     */
+    void feed(const char* data, std::size_t size);
+
+    /**
+     * Indicates whether this parser has encountered the final boundary
+     * of the body. Any data fed after the final boundary is ignored.
+     * 
+     * @return True if the body has been parsed completely, false otherwise.
+     */
+    bool isDone() const;
+
+    /**
+     * Signals the end of the body to this parser.
+     * 
+     * @throws runtime_error If the body ended before its final boundary.
+     */
+    void finish();
+
+    /**
+     * Gets the boundary parameter of the specified Content-Type header value.
+     * 
+     * @param contentType The value of a Content-Type header.
+     * 
+     * @return The boundary of the multipart body, or an empty string
+     *         if the value does not specify a multipart content type
+     *         or does not have a boundary parameter.
+     */
+    static std::string getBoundary(std::string_view contentType);
+
+    /**
+     * Parses the multipart/form-data body of the specified request,
+     * passing all parts to the specified handler. The body is read directly
+     * from the request stream through RequestHTTP::readBody(), in chunks
+     * of MP_READ_BUFFER_SIZE bytes, so a body of any size is parsed in
+     * constant memory. The maximum body size of the route is enforced while
+     * the body is read. If parsing fails, then MultipartHandler::onAbort()
+     * is called before the exception is propagated to the caller.
+     * 
+     * @param request The RequestHTTP whose body to parse.
+     * @param handler The MultipartHandler to pass the parts to.
+     * 
+     * @throws PayloadTooLargeException If the body exceeds the maximum
+     *                                  body size of the route.
+     * @throws runtime_error If the request does not have a multipart body
+     *                       or if the body is malformed.
+     */
+    static void parse(RequestHTTP& request, MultipartHandler& handler);
+
+private:
+
+    /**
+     * Parses the specified header line of the current part.
+     * 
+     * @param line A view of the header line, without the line break.
+     * 
+     * @throws runtime_error If the header line is malformed.
+     */
+    void _parseHeader(std::string_view line);
+
+    /**
+     * Finds the next delimiter in the buffer, starting at the
+     * specified position.
+     * 
+     * @param pos The position in the buffer to start searching from.
+     * 
+     * @return The position of the delimiter in the buffer, or
+     *         std::string::npos if the buffer does not contain a delimiter.
+     */
+    std::size_t _findDelimiter(std::size_t pos) const;
+
+}; // END CLASS MultipartParser
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_MULTIPART_PARSER_H
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_RATE_LIMIT_STATS_H
+#define RAVEN_NET_RATE_LIMIT_STATS_H
+
+#include <cstdint>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Process-wide counters of the inbound rate limiting applied to
+ * web socket sessions. See WebSocketOptions for how to configure limits.
+ */
+struct RateLimitStats {
+
+    //The number of sessions which have exceeded their limits at least once
+    std::uint64_t throttledSessions;
+    //The number of messages which were delayed by the PAUSE action
+    std::uint64_t pausedMessages;
+    //The number of messages which were discarded by the DROP action
+    std::uint64_t droppedMessages;
+    //The number of sessions which were closed by the CLOSE action
+    std::uint64_t closedSessions;
+
+    /**
+     * Returns a snapshot of the current counter values.
+     * 
+     * @return The current RateLimitStats.
+     */
+    static RateLimitStats get();
+
+}; // END STRUCT RateLimitStats
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_RATE_LIMIT_STATS_H
@@ -17,11 +17,19 @@
 #ifndef RAVEN_NET_REQUEST_HTTP_H
 #define RAVEN_NET_REQUEST_HTTP_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
 
 #include "Poco/Buffer.h"
 #include "Poco/Net/NameValueCollection.h"
 
+#include "raven/net/MethodHTTP.h"
+#include "raven/net/HeaderHTTP.h"
+
 
 namespace raven {
 namespace net {
@@ -29,6 +37,33 @@ namespace net {
 //Forward declaration
 class ServerRequestProviderHTTP;
 
+/**
+ * A parameter captured from the URI path of a request by a route
+ * pattern. Both views point into data which lives at least as long
+ * as the request is handled.
+ */
+struct PathParam {
+
+    //The name of the parameter, as declared in the route pattern
+    std::string_view name;
+    //The value of the parameter, as it appears in the URI path
+    std::string_view value;
+
+}; // END STRUCT PathParam
+
+/**
+ * Thrown when a request body exceeds the maximum body size
+ * of the route which handles the request.
+ */
+class PayloadTooLargeException : public std::runtime_error {
+
+public:
+
+    PayloadTooLargeException()
+        :std::runtime_error("Request body exceeds the maximum size"){ }
+
+}; // END CLASS PayloadTooLargeException
+
 /**
  * Represents a network request over HTTP(S). Instances of this class provide
  * access to the data associated with a request, such as payload and meta data.
@@ -62,6 +97,36 @@ public:
      */
     std::string& getURIpath();
 
+    /**
+     * Gets the path component of this request's URI as a view into
+     * the request URI, without copying it.
+     * 
+     * @return The URI path of this request. The view is valid for as
+     *         long as this request is handled.
+     */
+    std::string_view getURIpathView();
+
+    /**
+     * Gets the parameters captured from the URI path of this request
+     * by the pattern of the matched route, in the order in which they
+     * appear in the pattern. The values are not percent-decoded.
+     * 
+     * @return All path parameters of this request.
+     */
+    const std::vector<PathParam>& getPathParams();
+
+    /**
+     * Gets the value of the path parameter with the specified name.
+     * See getPathParams().
+     * 
+     * @param name The name of the path parameter, as declared
+     *             in the route pattern.
+     * 
+     * @return A view of the value of the path parameter, or an empty
+     *         view if the matched route has no such parameter.
+     */
+    std::string_view getPathParam(std::string_view name);
+
     /**
      * Gets the HTTP method (e.g. "GET" or "POST") of this request.
      * 
@@ -70,35 +135,200 @@ public:
     const std::string& getMethod();
 
     /**
-     * Gets the HTTP headers of this request.
+     * Gets the HTTP method of this request as an enum constant.
+     * The method name is parsed only once per request.
+     * 
+     * @return The HTTP method used for this request, or
+     *         MethodHTTP::HTTP_OTHER if the method is unknown.
+     */
+    MethodHTTP getMethodType();
+
+    /**
+     * Gets the HTTP headers of this request. Since the returned
+     * collection may be modified at any time, getHeader() and getCookie()
+     * stop using their indexes once this function was called and look up
+     * the current headers on every call instead. Views previously returned
+     * by these functions must not be used after the headers are modified.
      * 
      * @return All HTTP headers of this request, as a NameValueCollection.
      */
     Poco::Net::NameValueCollection& getHeaders();
 
     /**
-     * Gets the query parameters of this request.
+     * Gets the value of the specified well-known HTTP header of this
+     * request. All well-known headers are indexed in a single pass over
+     * the headers on first access, so subsequent calls are array lookups,
+     * unless the headers were requested through getHeaders().
+     * If a header occurs multiple times, the first occurrence is returned.
+     * 
+     * @param header The header to get.
+     * 
+     * @return The value of the header, or an empty view if this request
+     *         does not have the header. The view is valid for as long as
+     *         this request is handled and its headers are not modified.
+     */
+    std::string_view getHeader(HeaderHTTP header);
+
+    /**
+     * Gets the value of the HTTP header with the specified name.
+     * Well-known headers are served from the index described in
+     * getHeader(HeaderHTTP), other headers are looked up in the
+     * collection returned by getHeaders().
+     * 
+     * @param name The case-insensitive name of the header.
+     * 
+     * @return The value of the header, or an empty view if this request
+     *         does not have the header. The view is valid for as long as
+     *         this request is handled and its headers are not modified.
+     */
+    std::string_view getHeader(std::string_view name);
+
+    /**
+     * Indicates whether this request has the specified
+     * well-known HTTP header.
+     * 
+     * @param header The header to check.
+     * 
+     * @return True if this request has the header, false otherwise.
+     */
+    bool hasHeader(HeaderHTTP header);
+
+    /**
+     * Gets the query parameters of this request. The query is split at
+     * each '&', tokens are trimmed and parameters without a value are
+     * ignored. Names and values are not percent-decoded.
      * 
      * @return All query parameters of this request, as a NameValueCollection.
      */
     Poco::Net::NameValueCollection& getQueryParams();
 
+    /**
+     * Gets the value of the query parameter with the specified name.
+     * The query is sliced in place the first time it is accessed and a
+     * value is only percent-decoded when it is read. Values which contain
+     * no escapes are returned as views into the request URI.
+     * Parameters are sliced like in getQueryParams(), i.e. tokens are
+     * trimmed and parameters without a value are ignored. Unlike
+     * getQueryParams(), names and values are percent-decoded.
+     * 
+     * @param name The decoded name of the query parameter.
+     * 
+     * @return The decoded value of the first query parameter with the
+     *         specified name, or an empty view if there is no such
+     *         parameter. The view is valid for as long as this request
+     *         is handled.
+     */
+    std::string_view getQueryParam(std::string_view name);
+
+    /**
+     * Indicates whether this request has a query parameter with
+     * the specified name. See getQueryParam().
+     * 
+     * @param name The decoded name of the query parameter.
+     * 
+     * @return True if the query has a parameter with the specified name,
+     *         false otherwise.
+     */
+    bool hasQueryParam(std::string_view name);
+
+    /**
+     * Gets the value of the cookie with the specified name. The Cookie
+     * header is sliced in place the first time a cookie is accessed, so
+     * lookups by name do not allocate. Surrounding double quotes are
+     * removed from the value, no other decoding is applied.
+     * 
+     * @param name The case-sensitive name of the cookie.
+     * 
+     * @return The value of the first cookie with the specified name,
+     *         or an empty view if there is no such cookie. The view is
+     *         valid for as long as this request is handled and its
+     *         headers are not modified.
+     */
+    std::string_view getCookie(std::string_view name);
+
+    /**
+     * Indicates whether this request has a cookie with the
+     * specified name. See getCookie().
+     * 
+     * @param name The case-sensitive name of the cookie.
+     * 
+     * @return True if this request has a cookie with the
+     *         specified name, false otherwise.
+     */
+    bool hasCookie(std::string_view name);
+
+    /**
+     * Gets the length of the HTTP request body, as declared by
+     * the Content-Length header of this request.
+     * 
+     * @return The declared length of the request body in bytes,
+     *         or -1 if this request does not declare its length.
+     */
+    std::int64_t getContentLength();
+
     /**
      * Gets HTTP request body, as a string.
      * 
      * @return The entire HTTP request body. Returns an empty string if
      *         no body was supplied in the request.
+     * 
+     * @throws PayloadTooLargeException If the body exceeds the maximum
+     *                                  body size of the route.
+     * @throws runtime_error If the body has already been
+     *                       consumed through readBody().
      */
     std::string& body();
 
+    /**
+     * Gets HTTP request body, as a view. The body is read once, directly
+     * into the string returned by body() or the buffer returned by bodyRaw(),
+     * whichever has been requested first, and this method returns a view of
+     * it without copying. Prefer this method over body() when the body
+     * does not need to be modified.
+     * 
+     * @return A view of the entire HTTP request body. Returns an empty
+     *         view if no body was supplied in the request. The view is
+     *         valid for as long as this request is handled.
+     * 
+     * @throws PayloadTooLargeException If the body exceeds the maximum
+     *                                  body size of the route.
+     * @throws runtime_error If the body has already been
+     *                       consumed through readBody().
+     */
+    std::string_view bodyView();
+
     /**
      * Gets raw HTTP request body, as a char buffer.
      * 
      * @return The entire HTTP request body. Returns an empty buffer if
      *         no body was supplied in the request.
+     * 
+     * @throws PayloadTooLargeException If the body exceeds the maximum
+     *                                  body size of the route.
+     * @throws runtime_error If the body has already been
+     *                       consumed through readBody().
      */
     Poco::Buffer<char>& bodyRaw();
 
+    /**
+     * Reads the next part of the HTTP request body into the specified
+     * buffer, without buffering the entire body. Blocks until the buffer
+     * is full or the end of the body is reached. Once a part of the body
+     * has been read by this method, the body is no longer available through
+     * body() or bodyRaw(). If the body has already been buffered by one of
+     * those methods, this method reads from the buffered body.
+     * 
+     * @param buffer The buffer to read into.
+     * @param size The size of the buffer, in bytes.
+     * 
+     * @return The number of bytes read. Returns zero if the end
+     *         of the body has been reached.
+     * 
+     * @throws PayloadTooLargeException If the body exceeds the maximum
+     *                                  body size of the route.
+     */
+    std::size_t readBody(char* buffer, std::size_t size);
+
     /**
      * Indicates whether this HTTP request was established through a
      * secure communication channel, i.e. using HTTPS instead of plain HTTP.
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_ROUTE_OPTIONS_H
+#define RAVEN_NET_ROUTE_OPTIONS_H
+
+#include <cstddef>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Configuration options for requests routed through a specific route.
+ * A default-constructed RouteOptions object represents the
+ * default behaviour.
+ */
+struct RouteOptions {
+
+    /**
+     * The maximum size of a request body, in bytes. Requests which
+     * declare a larger Content-Length are rejected with a 413 response
+     * before the controller is called. Bodies without a declared length
+     * are checked while they are read, in which case reading the body
+     * throws a PayloadTooLargeException, which the router answers with
+     * a 413 response unless the controller has already sent a response.
+     * A value of zero disables the limit.
+     */
+    std::size_t maxBodySize = 0;
+
+}; // END STRUCT RouteOptions
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_ROUTE_OPTIONS_H
@@ -17,20 +17,32 @@
 #ifndef RAVEN_NET_ROUTER_HTTP_H
 #define RAVEN_NET_ROUTER_HTTP_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <functional>
+#include <utility>
 
+#include "raven/net/MethodHTTP.h"
+#include "raven/net/MiddlewareChain.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
+#include "raven/net/RouteOptions.h"
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/TypedWebSocketController.h"
 #include "raven/net/WebSocketDispatcher.h"
+#include "raven/net/WebSocketOptions.h"
 
 
 namespace raven {
 namespace net {
 
+//Forward declarations
+class RouteTree;
+class StaticRouteTable;
+
 /**
  * Instances of this class route server requests to the
  * corresponding controller instances. When a request to a server is made,
@@ -88,6 +100,40 @@ public:
  */
 class BasicRouterHTTP : public RouterHTTP {
 
+    friend class MiddlewareChain;
+
+    typedef std::function<void(RequestHTTP&, ResponseHTTP&)> RouteHandler;
+
+    /**
+     * A single route handler together with the options of its route.
+     */
+    struct RouteEntry {
+        RouteHandler handler;
+        RouteOptions options;
+    };
+
+    /**
+     * The handlers of all routes defined for a single path.
+     */
+    struct RouteTable {
+        //The handler for requests with any method
+        RouteEntry any;
+        //The handlers for specific methods, indexed by MethodHTTP
+        RouteEntry methods[METHOD_HTTP_COUNT];
+        //The value of the 'Allow' header of a 405 response
+        std::string allow;
+    };
+
+    std::unordered_map<std::string, std::vector<std::pair<MethodHTTP, RouteEntry>>>
+        _methodRoutes;
+
+    std::unordered_map<std::string, RouteOptions> _routeOptions;
+
+    std::shared_ptr<StaticRouteTable> _staticRoutes;
+    std::shared_ptr<RouteTree> _routeTree;
+    std::vector<RouteTable> _routeTables;
+    std::vector<Middleware> _middleware;
+
 public:
 
     BasicRouterHTTP();
@@ -99,12 +145,19 @@ public:
 
     /**
      * Called by a server implementation to initialize
-     * the router internal state.
+     * the router internal state. Calls defineRoutes() and then
+     * compiles all defined routes. Routes with literal paths are put into
+     * an immutable hash table, routes with path patterns into a radix tree.
+     * Routes defined after this method has returned are ignored.
+     * 
+     * @throws runtime_error If a route pattern is malformed or
+     *                       conflicts with another route.
      */
     virtual void initialize();
 
     /**
-     * Routes the server request to the responsible controller.
+     * Routes the server request to the responsible controller,
+     * after passing it through all middleware of this router.
      * 
      * @param request A reference to the RequestHTTP object to route
      *                to the controller.
@@ -113,6 +166,19 @@ public:
      */
     virtual void route(RequestHTTP& request, ResponseHTTP& response);
 
+    /**
+     * Adds the specified middleware to the end of the middleware chain
+     * of this router. Every routed request, including requests initiating
+     * web socket connections, passes through all middleware in the order
+     * in which it was added before it is routed to a controller. This
+     * method must be called from within defineRoutes().
+     * 
+     * @param middleware The middleware to add.
+     * 
+     * @throws runtime_error If this router has already been initialized.
+     */
+    void middleware(Middleware middleware);
+
     /**
      * This method is called when no route exists for
      * a given server request.
@@ -125,10 +191,43 @@ public:
     virtual void onError404(RequestHTTP& request, ResponseHTTP& response);
 
     /**
-     * Defines a static route for the router implementation.
+     * This method is called when a route exists for the URI path of
+     * a given server request, but not for its HTTP method. The 'Allow'
+     * header of the response is already set to the methods for which
+     * routes exist.
      * 
-     * @param path The URI path for which the specified controller
-     *             method should be called.
+     * @param request A reference to the RequestHTTP object of
+     *                the unrouteable request.
+     * @param response A reference to the ResponseHTTP object of
+     *                the unrouteable request.
+     */
+    virtual void onError405(RequestHTTP& request, ResponseHTTP& response);
+
+    /**
+     * This method is called when the body of a given server request
+     * exceeds the maximum body size of its route. The connection is
+     * closed after the response has been sent.
+     * 
+     * @param request A reference to the RequestHTTP object of
+     *                the rejected request.
+     * @param response A reference to the ResponseHTTP object of
+     *                the rejected request.
+     */
+    virtual void onError413(RequestHTTP& request, ResponseHTTP& response);
+
+    /**
+     * Defines a route for the router implementation.
+     * The path may be a pattern containing named parameters, written as
+     * '{name}', which match one entire path segment, and a trailing
+     * wildcard, written as '*name', which matches the remainder of the
+     * path. For example, the pattern '/users/{id}/orders' matches the
+     * path '/users/42/orders'. Static segments take priority over
+     * parameters, and parameters take priority over wildcards. The
+     * values captured by a match are available through
+     * RequestHTTP::getPathParam().
+     * 
+     * @param path The URI path or pattern for which the specified
+     *             controller method should be called.
      * @param method The controller method responsible for the handling
      *               HTTP requests for the specified URI path.
      */
@@ -136,6 +235,81 @@ public:
         const std::string& path,
         std::function<void(RequestHTTP&, ResponseHTTP&)> method);
 
+    /**
+     * Defines a route for the router implementation, using the specified
+     * options for all requests routed through it. See staticRoute(path, method).
+     * 
+     * @param path The URI path or pattern for which the specified
+     *             controller method should be called.
+     * @param method The controller method responsible for the handling
+     *               HTTP requests for the specified URI path.
+     * @param options The RouteOptions to apply to the requests.
+     */
+    void staticRoute(
+        const std::string& path,
+        std::function<void(RequestHTTP&, ResponseHTTP&)> method,
+        const RouteOptions& options);
+
+    /**
+     * Defines a route for the router implementation which only handles
+     * requests with the specified HTTP method. See staticRoute(path, method)
+     * for the supported path patterns. Requests to a path for which only
+     * routes with other methods are defined are answered by onError405().
+     * A route defined without a method handles all methods for which no
+     * specific route is defined. A GET route also handles HEAD requests,
+     * unless a HEAD route is defined for the same path.
+     * 
+     * @param httpMethod The HTTP method of the route.
+     *                   Must not be MethodHTTP::HTTP_OTHER.
+     * @param path The URI path or pattern for which the specified
+     *             controller method should be called.
+     * @param method The controller method responsible for the handling
+     *               HTTP requests for the specified method and URI path.
+     * 
+     * @throws runtime_error If the HTTP method is MethodHTTP::HTTP_OTHER.
+     */
+    void staticRoute(
+        MethodHTTP httpMethod,
+        const std::string& path,
+        std::function<void(RequestHTTP&, ResponseHTTP&)> method);
+
+    /**
+     * Defines a route for the router implementation which only handles
+     * requests with the specified HTTP method, using the specified options
+     * for all requests routed through it. See staticRoute(httpMethod, path, method).
+     * 
+     * @param httpMethod The HTTP method of the route.
+     *                   Must not be MethodHTTP::HTTP_OTHER.
+     * @param path The URI path or pattern for which the specified
+     *             controller method should be called.
+     * @param method The controller method responsible for the handling
+     *               HTTP requests for the specified method and URI path.
+     * @param options The RouteOptions to apply to the requests.
+     * 
+     * @throws runtime_error If the HTTP method is MethodHTTP::HTTP_OTHER.
+     */
+    void staticRoute(
+        MethodHTTP httpMethod,
+        const std::string& path,
+        std::function<void(RequestHTTP&, ResponseHTTP&)> method,
+        const RouteOptions& options);
+
+    /**
+     * Defines a static route which reports the traffic statistics of all
+     * web socket sessions as JSON. The sessions are sorted by the counter
+     * specified by the 'sort' query parameter, which is one of 'bytesOut'
+     * (default), 'bytesIn', 'messagesOut', 'messagesIn' and 'queueDepth',
+     * in descending order, or 'connectedAt' and 'lastActivity', oldest
+     * first. The query parameters 'offset' and 'limit' select the page of
+     * sessions to return. The limit defaults to 100 and is at most 1000.
+     * 
+     * The report exposes session IDs, so the route should only be
+     * reachable by administrators.
+     * 
+     * @param path The URI path of the statistics route.
+     */
+    void sessionStatsRoute(const std::string& path);
+
     /**
      * Defines a static route for initiating web socket connections.
      * 
@@ -150,6 +324,108 @@ public:
         const std::string& path,
         WebSocketController& controller);
 
+    /**
+     * Defines a static route for initiating web socket connections,
+     * using the specified options for all connections established
+     * through that route.
+     * 
+     * @param path The URI path for which the specified WebSocketController
+     *             should be used to handle the connection.
+     * @param controller A reference to the WebSocketController instance
+     *                   responsible for handling web socket connections
+     *                   initially established by a client request to the
+     *                   specified URI path.
+     * @param options The WebSocketOptions to apply to the connections.
+     */
+    void webSocketRoute(
+        const std::string& path,
+        WebSocketController& controller,
+        const WebSocketOptions& options);
+
+    /**
+     * Defines a static route for initiating web socket connections
+     * handled by a TypedWebSocketController. This method is instantiated
+     * with the concrete controller type, so that messages are dispatched
+     * to the controller without virtual calls.
+     * 
+     * @param path The URI path for which the specified controller
+     *             should be used to handle the connection.
+     * @param controller A reference to the TypedWebSocketController
+     *                   instance responsible for handling web socket
+     *                   connections initially established by a client
+     *                   request to the specified URI path.
+     */
+    template<typename Controller>
+    void webSocketRoute(
+        const std::string& path,
+        TypedWebSocketController<Controller>& controller){
+
+        webSocketRoute(path, controller, WebSocketOptions());
+    }
+
+    /**
+     * Defines a static route for initiating web socket connections
+     * handled by a TypedWebSocketController, using the specified options
+     * for all connections established through that route.
+     * 
+     * @param path The URI path for which the specified controller
+     *             should be used to handle the connection.
+     * @param controller A reference to the TypedWebSocketController
+     *                   instance responsible for handling web socket
+     *                   connections initially established by a client
+     *                   request to the specified URI path.
+     * @param options The WebSocketOptions to apply to the connections.
+     */
+    template<typename Controller>
+    void webSocketRoute(
+        const std::string& path,
+        TypedWebSocketController<Controller>& controller,
+        const WebSocketOptions& options){
+
+        _webSocketRoute(
+            path,
+            WebSocketControllerBinding::of(
+                static_cast<Controller&>(controller)),
+            options);
+    }
+
+private:
+
+    /**
+     * Routes the server request to the responsible controller,
+     * after it has passed all middleware.
+     * 
+     * @param request A reference to the RequestHTTP object to route.
+     * @param response A reference to the ResponseHTTP object to route.
+     */
+    void _dispatch(RequestHTTP& request, ResponseHTTP& response);
+
+    /**
+     * Calls the handler of the specified route entry, enforcing
+     * the options of the route.
+     * 
+     * @param entry The matched route entry.
+     * @param request A reference to the RequestHTTP object to handle.
+     * @param response A reference to the ResponseHTTP object to handle.
+     */
+    void _invoke(
+        const RouteEntry& entry,
+        RequestHTTP& request,
+        ResponseHTTP& response);
+
+    /**
+     * Defines a static route for initiating web socket connections
+     * handled by the specified controller binding.
+     * 
+     * @param path The URI path of the route.
+     * @param binding The binding of the responsible controller.
+     * @param options The WebSocketOptions to apply to the connections.
+     */
+    void _webSocketRoute(
+        const std::string& path,
+        const WebSocketControllerBinding& binding,
+        const WebSocketOptions& options);
+
 }; // END CLASS BasicRouterHTTP
 
 } // END NAMESPACE net
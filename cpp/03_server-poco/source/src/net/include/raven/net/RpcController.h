@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_RPC_CONTROLLER_H
+#define RAVEN_NET_RPC_CONTROLLER_H
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <functional>
+#include <stdexcept>
+
+#include "Poco/Dynamic/Var.h"
+#include "Poco/JSON/Object.h"
+
+#include "raven/net/WebSocketController.h"
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace util {
+
+// Forward declaration
+class WorkerPool;
+
+} // END NAMESPACE util
+
+namespace net {
+
+/**
+ * Exception type for failed remote procedure calls. The error code
+ * follows the JSON-RPC 2.0 specification.
+ */
+class RpcException : public std::runtime_error {
+
+    int _code;
+
+public:
+
+    static constexpr int PARSE_ERROR = -32700;
+    static constexpr int INVALID_REQUEST = -32600;
+    static constexpr int METHOD_NOT_FOUND = -32601;
+    static constexpr int INTERNAL_ERROR = -32603;
+    static constexpr int TIMEOUT = -32000;
+    static constexpr int SESSION_CLOSED = -32001;
+    static constexpr int SERVER_BUSY = -32002;
+
+    /**
+     * Constructs a new RpcException.
+     * 
+     * @param code The error code.
+     * @param message The error message.
+     */
+    RpcException(int code, const std::string& message);
+
+    /**
+     * Gets the error code of this RpcException.
+     * 
+     * @return The error code.
+     */
+    int getCode() const;
+
+}; // END CLASS RpcException
+
+/**
+ * Function type for handlers of remote procedure calls. A handler
+ * receives the Session the call originates from and the call parameters,
+ * and returns the call result. A handler can throw an RpcException
+ * to respond with a specific error.
+ */
+typedef std::function<
+    Poco::Dynamic::Var(Session&, const Poco::Dynamic::Var&)> RpcHandler;
+
+/**
+ * Web socket controller implementing a request/response channel on top
+ * of a Session. Every text message is treated as a JSON-RPC 2.0 object.
+ * 
+ * Calls from the client are dispatched by method name to the handlers
+ * registered with registerMethod(). Handlers are executed concurrently
+ * by a pool of worker threads, so a slow call does not block subsequent
+ * calls on the same Session. The response carries the ID of the request.
+ * The number of calls from a single Session which are queued or executed
+ * at the same time is limited. Calls exceeding the limit are rejected with
+ * a Server Busy error. Batch requests are not supported and are answered
+ * with an Invalid Request error.
+ * 
+ * Calls from the server to the client are made with call(). Any number of
+ * calls can be in flight on a Session at the same time. Each call has its
+ * own deadline and is correlated with its response by a unique ID.
+ * Responses are never answered. A response with a malformed error
+ * object completes the call with an Internal Error.
+ * 
+ * All handlers should be registered before the controller is used in a
+ * web socket route. Subclasses overriding onDisconnect() or
+ * onMessageReceived() must call the base class implementation.
+ */
+class RpcController : public WebSocketController {
+
+    /**
+     * A call made by the server which has not yet been answered.
+     */
+    struct PendingCall {
+        std::string sessionID;
+        std::chrono::steady_clock::time_point deadline;
+        std::promise<Poco::Dynamic::Var> result;
+    };
+
+    std::unordered_map<std::string, RpcHandler> _handlers;
+    std::unordered_map<std::uint64_t, PendingCall> _calls;
+    std::unordered_map<std::string, std::size_t> _inFlight;
+    const std::size_t _maxInFlight;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::atomic<std::uint64_t> _nextCallID;
+    std::unique_ptr<raven::util::WorkerPool> _workers;
+    std::thread _reaper;
+    bool _isRunning = true;
+
+public:
+
+    /**
+     * Constructs a new RpcController which uses one worker thread
+     * per hardware thread to execute handlers.
+     */
+    RpcController();
+
+    /**
+     * Constructs a new RpcController which uses the specified
+     * number of worker threads to execute handlers.
+     * 
+     * @param numWorkers The number of worker threads.
+     */
+    RpcController(std::size_t numWorkers);
+
+    /**
+     * Constructs a new RpcController which uses the specified
+     * number of worker threads to execute handlers.
+     * 
+     * @param numWorkers The number of worker threads.
+     * @param maxInFlight The maximum number of calls from a single
+     *                    Session which are queued or executed at
+     *                    the same time.
+     */
+    RpcController(std::size_t numWorkers, std::size_t maxInFlight);
+
+    RpcController(RpcController const&) = delete;
+
+    void operator=(RpcController const&) = delete;
+
+    virtual ~RpcController();
+
+    /**
+     * Registers the handler for the specified method name.
+     * Any previously registered handler for that name is replaced.
+     * 
+     * @param method The name of the method.
+     * @param handler The handler to execute when the method is called.
+     */
+    void registerMethod(const std::string& method, RpcHandler handler);
+
+    /**
+     * Calls the specified method on the client of the specified Session.
+     * This method does not block. If no response is received before the
+     * specified timeout has elapsed, or if the Session is closed in the
+     * meantime, the returned future holds an RpcException.
+     * 
+     * @param session The Session of the client to call.
+     * @param method The name of the method to call.
+     * @param params The call parameters.
+     * @param timeout The maximum duration to wait for a response.
+     * 
+     * @return A future holding the result of the call.
+     */
+    std::future<Poco::Dynamic::Var> call(
+        Session& session,
+        const std::string& method,
+        const Poco::Dynamic::Var& params,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * Sends a notification to the client of the specified Session, i.e.
+     * a call of the specified method for which no response is expected.
+     * 
+     * @param session The Session of the client to notify.
+     * @param method The name of the method to call.
+     * @param params The call parameters.
+     */
+    void notify(
+        Session& session,
+        const std::string& method,
+        const Poco::Dynamic::Var& params);
+
+    virtual void onDisconnect(Session& session);
+
+    virtual void onMessageReceived(Session& session, Message& message);
+
+private:
+
+    /**
+     * Executes the handler of the specified request and sends the
+     * response to the client. Releases the in-flight slot of the request.
+     * 
+     * @param session The Session the request originates from.
+     * @param id The ID of the request. Empty for notifications.
+     * @param method The name of the called method.
+     * @param params The call parameters.
+     */
+    void _execute(
+        std::shared_ptr<Session> session,
+        const Poco::Dynamic::Var& id,
+        const std::string& method,
+        const Poco::Dynamic::Var& params);
+
+    /**
+     * Handles the response of the client to a call made by the server.
+     * Never sends anything back to the client.
+     * 
+     * @param response The response object.
+     */
+    void _receiveResponse(const Poco::JSON::Object& response);
+
+    /**
+     * Takes an in-flight slot for a request of the specified Session.
+     * 
+     * @param sessionID The ID of the Session the request originates from.
+     * 
+     * @return True if the slot was taken, false if the Session has
+     *         already reached the maximum number of in-flight requests.
+     */
+    bool _acquire(const std::string& sessionID);
+
+    /**
+     * Releases an in-flight slot of the specified Session.
+     * 
+     * @param sessionID The ID of the Session the request originates from.
+     */
+    void _release(const std::string& sessionID);
+
+    /**
+     * Completes the pending call with the specified ID.
+     * 
+     * @param id The ID of the call.
+     * @param result The result of the call. Ignored if an error is given.
+     * @param error The error of the call. May be null.
+     */
+    void _complete(
+        std::uint64_t id,
+        const Poco::Dynamic::Var& result,
+        std::exception_ptr error);
+
+    /**
+     * Reaper thread loop implementation. Fails all pending
+     * calls whose deadline has passed.
+     */
+    void _reaperLoop();
+
+}; // END CLASS RpcController
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_RPC_CONTROLLER_H
@@ -26,6 +26,7 @@
 #include "Poco/Util/ServerApplication.h"
 
 #include "raven/net/RouterHTTP.h"
+#include "raven/net/BroadcastBus.h"
 
 
 namespace raven {
@@ -39,6 +40,7 @@ class ServerTCP : public Poco::Util::ServerApplication {
 
     const unsigned short _port;
     std::shared_ptr<RouterHTTP> _router;
+    std::shared_ptr<BroadcastBus> _bus;
 
 protected:
 
@@ -84,6 +86,16 @@ public:
     virtual Poco::Net::HTTPRequestHandlerFactory* requestHandlerFactory(
         std::shared_ptr<RouterHTTP> router);
 
+    /**
+     * Provides a BroadcastBus to be used by the server. The server starts
+     * the bus before it starts accepting connections and stops it when
+     * the server is shut down. This method can be implemented by the
+     * user of the ServerTCP class. By default, no BroadcastBus is used.
+     * 
+     * @return A BroadcastBus to be used by the server, or nullptr.
+     */
+    virtual std::shared_ptr<BroadcastBus> broadcastBus();
+
     /**
      * This callback method is called when the server has been requested to
      * start its operation but before it has finished the startup operation.
@@ -18,7 +18,15 @@
 #define RAVEN_NET_SESSION_H
 
 #include <memory>
+#include <cstddef>
 #include <string>
+#include <chrono>
+#include <future>
+#include <atomic>
+
+#include "raven/net/Message.h"
+#include "raven/net/SessionAttribute.h"
+#include "raven/net/SessionStats.h"
 
 
 namespace raven {
@@ -29,10 +37,14 @@ class WebSocketSessionProvider;
 
 /**
  * Represents a session for a web socket connection.
+ * Sessions are always owned by a shared pointer.
  */
-class Session {
+class Session : public std::enable_shared_from_this<Session> {
 
     std::shared_ptr<WebSocketSessionProvider> _session;
+    std::atomic<void*> _attributes[SESSION_MAX_ATTRIBUTES];
+
+    void* _initAttribute(std::size_t slot, void* value);
 
 public:
 
@@ -44,12 +56,39 @@ public:
      */
     Session(std::shared_ptr<WebSocketSessionProvider> session);
 
+    /**
+     * Destroys this Session and all of its attribute values.
+     */
+    ~Session();
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
     /**
      * Returns the unique ID of this Session
      * 
      * @return The ID of this Session.
      */
-    std::string getID() const;
+    const std::string& getID() const;
+
+    /**
+     * Returns the token which a client must present in order to resume
+     * this Session after its connection has dropped. The token should
+     * be communicated to the client through the application protocol.
+     * 
+     * @return The resume token of this Session, or an empty string
+     *         if this Session is not resumable.
+     */
+    std::string getResumeToken() const;
+
+    /**
+     * Indicates whether this Session was resumed by a client after
+     * a previous connection had dropped.
+     * 
+     * @return True if this Session is a resumed session,
+     *         false if it was newly created.
+     */
+    bool isResumed() const;
 
     /**
      * Closes this web socket Session. This causes the underlying web socket
@@ -68,12 +107,237 @@ public:
 
     /**
      * Sends the specified string message to the client of
-     * this web socket session.
+     * this web socket session. The message is sent with
+     * MessagePriority::INTERACTIVE.
      * 
      * @param message The string message to send.
      */
     void send(const std::string& message);
 
+    /**
+     * Sends the specified string message to the client of
+     * this web socket session, using the specified priority.
+     * 
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     */
+    void send(const std::string& message, MessagePriority priority);
+
+    /**
+     * Sends the specified string message to the client of
+     * this web socket session, using the specified priority.
+     * The specified callback is invoked once the message has been
+     * written to the underlying socket, or when it was dropped or failed
+     * to be written. The callback is usually invoked by the writer thread
+     * of this Session and should therefore return quickly.
+     * 
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * @param onComplete The callback to invoke when the send
+     *                   operation has completed.
+     */
+    void send(
+        const std::string& message,
+        MessagePriority priority,
+        SendCallback onComplete);
+
+    /**
+     * Sends the specified string message to the client of
+     * this web socket session, using the specified priority.
+     * The returned future becomes ready once the message has been
+     * written to the underlying socket, or when it was dropped or failed
+     * to be written.
+     * 
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * 
+     * @return A future holding the outcome of the send operation.
+     */
+    std::future<SendStatus> sendAsync(
+        const std::string& message,
+        MessagePriority priority);
+
+    /**
+     * Sends the specified binary data to the client of this web socket
+     * session as a binary message. The message is sent with
+     * MessagePriority::INTERACTIVE. The data is moved into the outbound
+     * message without copying, so encoded data can be passed directly,
+     * e.g. session.sendBinary(encoder.release()).
+     * 
+     * @param data The binary data to send.
+     */
+    void sendBinary(std::string data);
+
+    /**
+     * Sends the specified binary data to the client of this web socket
+     * session as a binary message, using the specified priority.
+     * 
+     * @param data The binary data to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     */
+    void sendBinary(std::string data, MessagePriority priority);
+
+    /**
+     * Sends the specified binary data to the client of this web socket
+     * session as a binary message, using the specified priority.
+     * The specified callback is invoked once the message has been
+     * written to the underlying socket, or when it was dropped or failed
+     * to be written.
+     * 
+     * @param data The binary data to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * @param onComplete The callback to invoke when the send
+     *                   operation has completed.
+     */
+    void sendBinary(
+        std::string data,
+        MessagePriority priority,
+        SendCallback onComplete);
+
+    /**
+     * Sends a ping message with the specified payload to the client
+     * of this web socket session. Ping messages are always sent with
+     * MessagePriority::CONTROL, so they are written before any other
+     * pending message. Pings received from the client are answered
+     * automatically in the same way.
+     * 
+     * @param payload The payload of the ping message. Must not
+     *                exceed 125 bytes.
+     * 
+     * @throws runtime_error If the payload exceeds 125 bytes.
+     */
+    void sendPing(const std::string& payload);
+
+    /**
+     * Sends the content of the specified file to the client of this web
+     * socket session. The file is memory-mapped and sent as a sequence of
+     * binary messages of WebSocketOptions::fileChunkSize bytes each,
+     * without copying its content. Only a bounded number of messages of
+     * the file is queued at a time, as specified by
+     * WebSocketOptions::fileChunkWindow. The messages are sent with
+     * MessagePriority::BULK. An empty file is sent as a single
+     * empty binary message.
+     * 
+     * The file must not be modified while it is being sent.
+     * 
+     * @param path The path of the file to send.
+     * 
+     * @throws runtime_error If the file cannot be opened or mapped.
+     */
+    void sendFile(const std::string& path);
+
+    /**
+     * Sends the content of the specified file to the client of this
+     * web socket session, using the specified priority. See
+     * sendFile(const std::string&).
+     * The progress callback is invoked every time a message of the file has
+     * been written to the underlying socket. The completion callback is
+     * invoked once with SendStatus::WRITTEN after the entire file has
+     * been written, or with the status of the first message which could
+     * not be written, in which case the transfer is aborted. Both callbacks
+     * are usually invoked by the writer thread of this Session and should
+     * therefore return quickly.
+     * 
+     * @param path The path of the file to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the messages into.
+     * @param onProgress The callback to invoke when a part of the
+     *                   file has been written. May be null.
+     * @param onComplete The callback to invoke when the transfer
+     *                   has completed. May be null.
+     * 
+     * @throws runtime_error If the file cannot be opened or mapped.
+     */
+    void sendFile(
+        const std::string& path,
+        MessagePriority priority,
+        ProgressCallback onProgress,
+        SendCallback onComplete);
+
+    /**
+     * Returns the number of outbound messages of this Session which are
+     * currently waiting to be written to the underlying socket. Producers
+     * can use this value to apply backpressure.
+     * 
+     * @return The number of pending outbound messages.
+     */
+    std::size_t getQueueDepth() const;
+
+    /**
+     * Returns the time the oldest pending outbound message of this Session
+     * has been waiting to be written to the underlying socket. A growing
+     * queue age indicates that the client does not keep up with the
+     * messages sent to it.
+     * 
+     * @return The age of the oldest pending outbound message,
+     *         or zero if no messages are pending.
+     */
+    std::chrono::milliseconds getQueueAge() const;
+
+    /**
+     * Returns the rate at which outbound messages of this Session are
+     * written to the underlying socket, measured over the last second.
+     * 
+     * @return The number of messages written per second.
+     */
+    double getSendRate() const;
+
+    /**
+     * Returns a snapshot of the traffic counters of this Session.
+     * 
+     * @return The current SessionStats of this Session.
+     */
+    SessionStats getStats() const;
+
+    /**
+     * Returns the value of the specified attribute of this Session.
+     * The value is default-constructed on first access and then stays
+     * at the same address until this Session is destroyed, so callers
+     * may keep references to it for the lifetime of the Session.
+     * 
+     * Accessing a value is lock-free from any thread. Once the value
+     * exists, this method amounts to an atomic load and a pointer
+     * dereference. The value itself is not synchronized: a value which
+     * is only used from within the message callbacks of this Session is
+     * always accessed by the reader thread of this Session and needs no
+     * further synchronization, whereas a value which is shared with other
+     * threads must be synchronized by the application, e.g. by using
+     * an atomic value type.
+     * 
+     * @param attribute The attribute to get the value of.
+     * 
+     * @return A reference to the value of the specified attribute.
+     */
+    template<typename T>
+    T& getAttribute(const SessionAttribute<T>& attribute){
+        const std::size_t slot = attribute.getSlot();
+        void* value = _attributes[slot].load(std::memory_order_acquire);
+        if(!value){
+            value = _initAttribute(slot, new T());
+        }
+        return *static_cast<T*>(value);
+    }
+
+    /**
+     * Indicates whether the value of the specified attribute has
+     * been created in this Session.
+     * 
+     * @param attribute The attribute to check.
+     * 
+     * @return True if the attribute has a value in this Session,
+     *         false otherwise.
+     */
+    template<typename T>
+    bool hasAttribute(const SessionAttribute<T>& attribute) const{
+        return _attributes[attribute.getSlot()].load(
+            std::memory_order_acquire) != nullptr;
+    }
+
     std::shared_ptr<WebSocketSessionProvider> getSessionProvider();
 
 }; // END CLASS Session
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_ATTRIBUTE_H
+#define RAVEN_NET_SESSION_ATTRIBUTE_H
+
+#include <cstddef>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * The maximum number of session attributes which can be registered
+ * within a process.
+ */
+static const std::size_t SESSION_MAX_ATTRIBUTES = 32;
+
+/**
+ * Function type used to destroy the value of a session attribute.
+ */
+typedef void (*SessionAttributeDeleter)(void*);
+
+/**
+ * Assigns the slot indices of all session attributes.
+ * Used by SessionAttribute and Session. Applications should not
+ * have to use this class directly.
+ */
+class SessionAttributeRegistry {
+
+public:
+
+    /**
+     * Registers a new session attribute.
+     * 
+     * @param deleter The function which destroys values of the attribute.
+     * 
+     * @return The slot index assigned to the attribute.
+     * 
+     * @throws runtime_error If SESSION_MAX_ATTRIBUTES attributes
+     *                       have already been registered.
+     */
+    static std::size_t registerAttribute(SessionAttributeDeleter deleter);
+
+    /**
+     * Destroys the specified value of the attribute with the specified slot.
+     * 
+     * @param slot The slot index of the attribute.
+     * @param value The value to destroy.
+     */
+    static void destroy(std::size_t slot, void* value);
+
+}; // END CLASS SessionAttributeRegistry
+
+/**
+ * A typed key of a value which is stored per Session.
+ * Each SessionAttribute is assigned its own slot index when it is
+ * constructed, so accessing its value within a Session is an array
+ * access rather than a map lookup. Attributes are therefore meant
+ * to be registered once, typically as static objects, and then shared
+ * by all sessions. For example:
+ * 
+ *     static const SessionAttribute<UserInfo> USER;
+ *     ...
+ *     session.getAttribute(USER).name = "...";
+ * 
+ * @tparam T The type of the value. Must be default-constructible.
+ */
+template<typename T>
+class SessionAttribute {
+
+    std::size_t _slot;
+
+    static void _destroy(void* value){
+        delete static_cast<T*>(value);
+    }
+
+public:
+
+    /**
+     * Registers a new SessionAttribute.
+     * 
+     * @throws runtime_error If SESSION_MAX_ATTRIBUTES attributes
+     *                       have already been registered.
+     */
+    SessionAttribute()
+        :_slot(SessionAttributeRegistry::registerAttribute(&_destroy)){ }
+
+    /**
+     * Returns the slot index assigned to this SessionAttribute.
+     * 
+     * @return The slot index of this attribute.
+     */
+    std::size_t getSlot() const{
+        return _slot;
+    }
+
+}; // END CLASS SessionAttribute
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_ATTRIBUTE_H
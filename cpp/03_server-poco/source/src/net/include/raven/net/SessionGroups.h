@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_SESSION_GROUPS_H
+#define RAVEN_NET_SESSION_GROUPS_H
+
+#include <cstddef>
+#include <string>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Provides named groups of web socket sessions, e.g. chat rooms or
+ * tenants. Messages can be sent to all members of a group at once.
+ * A Session automatically leaves all its groups when it is disconnected.
+ * All functions are provided as static functions and are thread-safe.
+ */
+class SessionGroups {
+
+public:
+
+    /**
+     * Adds the specified Session to the specified group.
+     * The group is created if it does not exist yet.
+     * 
+     * @param session The Session to add.
+     * @param group The name of the group.
+     * 
+     * @return True if the Session was added, false if it already is
+     *         a member of the group or if it is closed.
+     */
+    static bool join(Session& session, const std::string& group);
+
+    /**
+     * Removes the specified Session from the specified group.
+     * The group is removed once it has no members left.
+     * 
+     * @param session The Session to remove.
+     * @param group The name of the group.
+     * 
+     * @return True if the Session was removed, false if it
+     *         is not a member of the group.
+     */
+    static bool leave(Session& session, const std::string& group);
+
+    /**
+     * Sends the specified string message to all members of the
+     * specified group. The message is sent with
+     * MessagePriority::INTERACTIVE.
+     * 
+     * @param group The name of the group.
+     * @param message The string message to send.
+     * 
+     * @return The number of members the message was sent to.
+     */
+    static std::size_t send(
+        const std::string& group,
+        const std::string& message);
+
+    /**
+     * Sends the specified string message to all members of the
+     * specified group, using the specified priority.
+     * 
+     * @param group The name of the group.
+     * @param message The string message to send.
+     * @param priority The priority lane of the outbound queue
+     *                 to put the message into.
+     * 
+     * @return The number of members the message was sent to.
+     */
+    static std::size_t send(
+        const std::string& group,
+        const std::string& message,
+        MessagePriority priority);
+
+    /**
+     * Returns the number of members of the specified group.
+     * 
+     * @param group The name of the group.
+     * 
+     * @return The number of members of the group, or zero
+     *         if the group does not exist.
+     */
+    static std::size_t size(const std::string& group);
+
+}; // END CLASS SessionGroups
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_GROUPS_H
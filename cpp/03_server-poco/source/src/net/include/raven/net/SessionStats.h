@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RAVEN_NET_SESSION_STATS_H
+#define RAVEN_NET_SESSION_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <chrono>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * A snapshot of the traffic counters of a single web socket session.
+ * Only messages are counted, control frames are included in the
+ * inbound counters.
+ */
+struct SessionStats {
+
+    //The ID of the session
+    std::string id;
+    //The number of messages received from the client
+    std::uint64_t messagesIn;
+    //The number of message payload bytes received from the client
+    std::uint64_t bytesIn;
+    //The number of messages written to the client
+    std::uint64_t messagesOut;
+    //The number of message payload bytes written to the client
+    std::uint64_t bytesOut;
+    //The number of outbound messages waiting to be written
+    std::size_t queueDepth;
+    //The time at which the connection of the session was established
+    std::chrono::system_clock::time_point connectedAt;
+    //The time at which a message was last received or written
+    std::chrono::system_clock::time_point lastActivity;
+
+}; // END STRUCT SessionStats
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_SESSION_STATS_H
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_TYPED_WEB_SOCKET_CONTROLLER_H
+#define RAVEN_NET_TYPED_WEB_SOCKET_CONTROLLER_H
+
+#include <exception>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Base class for web socket controllers which are dispatched
+ * without virtual calls. This is an alternative to the
+ * WebSocketController interface for high message rates.
+ * 
+ * Users should inherit from this class, passing their own class as the
+ * template argument, and declare the needed methods with the same
+ * signatures as the methods of this class. The methods must not be
+ * virtual. Methods that are not declared by the subclass default to the
+ * empty implementations of this class, which the compiler removes
+ * entirely. For example:
+ * 
+ * class ChatController : public TypedWebSocketController<ChatController> {
+ * public:
+ *     void onMessageReceived(Session& session, Message& message);
+ * };
+ * 
+ * A TypedWebSocketController is registered through the
+ * BasicRouterHTTP::webSocketRoute() overloads, which are instantiated
+ * with the concrete controller type.
+ */
+template<typename Derived>
+class TypedWebSocketController {
+
+public:
+
+    /**
+     * See WebSocketController::onConnect().
+     * 
+     * @param session A reference to the web socket Session.
+     */
+    void onConnect(Session& session){ }
+
+    /**
+     * See WebSocketController::onDisconnect().
+     * 
+     * @param session A reference to the web socket Session.
+     */
+    void onDisconnect(Session& session){ }
+
+    /**
+     * See WebSocketController::onMessageReceived().
+     * 
+     * @param session A reference to the web socket Session.
+     * @param message A reference to the received web socket Message.
+     */
+    void onMessageReceived(Session& session, Message& message){ }
+
+    /**
+     * See WebSocketController::onPingReceived().
+     * 
+     * @param session A reference to the web socket Session.
+     * @param message A reference to the received web socket Ping Message.
+     */
+    void onPingReceived(Session& session, Message& message){ }
+
+    /**
+     * See WebSocketController::onPongReceived().
+     * 
+     * @param session A reference to the web socket Session.
+     * @param message A reference to the received web socket Pong Message.
+     */
+    void onPongReceived(Session& session, Message& message){ }
+
+    /**
+     * See WebSocketController::onSlowConsumer().
+     * 
+     * @param session A reference to the web socket Session.
+     */
+    void onSlowConsumer(Session& session){ }
+
+    /**
+     * See WebSocketController::onError().
+     * 
+     * @param session A reference to the web socket Session.
+     * @param ex A reference to std::exception encountered.
+     */
+    void onError(Session& session, const std::exception& ex){ }
+
+}; // END CLASS TypedWebSocketController
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_TYPED_WEB_SOCKET_CONTROLLER_H
@@ -36,7 +36,9 @@ public:
 
     /**
      * This method is called when a web socket connection is first opened,
-     * after a successful HTTP handshake has occurred.
+     * after a successful HTTP handshake has occurred. It is also called
+     * when a client resumes a session, in which case Session::isResumed()
+     * returns true.
      * 
      * @param session A reference to the web socket Session.
      */
@@ -52,7 +54,8 @@ public:
 
     /**
      * This method is called when a regular data message is
-     * received from the client.
+     * received from the client. This can be either a text or
+     * a binary message, see Message::isBinary().
      * 
      * @param session A reference to the web socket Session.
      * @param message A reference to the received web socket Message.
@@ -75,6 +78,22 @@ public:
      */
     virtual void onPongReceived(Session& session, Message& message);
 
+    /**
+     * This method is called when a session exceeds one of the slow
+     * consumer thresholds specified in the WebSocketOptions of its route,
+     * i.e. when the client does not read outbound messages fast enough.
+     * The method is called once when the session starts lagging and
+     * is called again only after the session has caught up. It is called
+     * by the writer thread of the session after it has written a message,
+     * never by the thread that sends a message, and should therefore
+     * return quickly. A session whose writer is blocked by the remote
+     * endpoint is detected once the pending write completes. If eviction
+     * is enabled, the connection is shut down after this method returns.
+     * 
+     * @param session A reference to the web socket Session.
+     */
+    virtual void onSlowConsumer(Session& session);
+
     /**
      * This method is called when an error is encountered within a web socket connection
      * that cannot be handled automatically.
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_WEB_SOCKET_CONTROLLER_BINDING_H
+#define RAVEN_NET_WEB_SOCKET_CONTROLLER_BINDING_H
+
+#include <exception>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Binds a web socket controller instance to the entry points called by
+ * the connection handling of a web socket route. The entry points are
+ * instantiated for the concrete controller type, so that all calls to the
+ * controller, including the switch over the message type, are resolved at
+ * compile time. Only the entry point itself is called indirectly.
+ * 
+ * A binding does not own the controller instance. The controller must
+ * outlive all connections handled through the binding.
+ */
+struct WebSocketControllerBinding {
+
+    void* controller;
+    void (*onConnect)(void* controller, Session& session);
+    void (*onDisconnect)(void* controller, Session& session);
+    void (*onMessage)(void* controller, Session& session, Message& message);
+    void (*onSlowConsumer)(void* controller, Session& session);
+    void (*onError)(
+        void* controller,
+        Session& session,
+        const std::exception& ex);
+
+    /**
+     * Creates a binding for the specified controller.
+     * 
+     * @param controller The controller instance to bind.
+     * 
+     * @return A binding calling the methods of the
+     *         specified controller instance.
+     */
+    template<typename Controller>
+    static WebSocketControllerBinding of(Controller& controller){
+        return WebSocketControllerBinding{
+            static_cast<void*>(&controller),
+            &_onConnect<Controller>,
+            &_onDisconnect<Controller>,
+            &_onMessage<Controller>,
+            &_onSlowConsumer<Controller>,
+            &_onError<Controller>
+        };
+    }
+
+private:
+
+    template<typename Controller>
+    static void _onConnect(void* controller, Session& session){
+        static_cast<Controller*>(controller)->onConnect(session);
+    }
+
+    template<typename Controller>
+    static void _onDisconnect(void* controller, Session& session){
+        static_cast<Controller*>(controller)->onDisconnect(session);
+    }
+
+    template<typename Controller>
+    static void _onMessage(
+        void* controller,
+        Session& session,
+        Message& message){
+
+        Controller* c = static_cast<Controller*>(controller);
+        if(message.isPing()){
+            c->onPingReceived(session, message);
+        }else if(message.isPong()){
+            c->onPongReceived(session, message);
+        }else{
+            c->onMessageReceived(session, message);
+        }
+    }
+
+    template<typename Controller>
+    static void _onSlowConsumer(void* controller, Session& session){
+        static_cast<Controller*>(controller)->onSlowConsumer(session);
+    }
+
+    template<typename Controller>
+    static void _onError(
+        void* controller,
+        Session& session,
+        const std::exception& ex){
+
+        static_cast<Controller*>(controller)->onError(session, ex);
+    }
+
+}; // END STRUCT WebSocketControllerBinding
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_WEB_SOCKET_CONTROLLER_BINDING_H
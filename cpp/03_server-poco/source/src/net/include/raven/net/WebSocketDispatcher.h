@@ -18,6 +18,8 @@
 #define RAVEN_NET_WEB_SOCKET_DISPATCHER_H
 
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/WebSocketOptions.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 
@@ -30,12 +32,21 @@ namespace net {
  */
 class WebSocketDispatcher {
 
-    WebSocketController& _controller;
+    WebSocketControllerBinding _binding;
+    WebSocketOptions _options;
 
 public:
 
     WebSocketDispatcher(WebSocketController& controller);
 
+    WebSocketDispatcher(
+        WebSocketController& controller,
+        const WebSocketOptions& options);
+
+    WebSocketDispatcher(
+        const WebSocketControllerBinding& binding,
+        const WebSocketOptions& options);
+
     /**
      * Dispatches the a web socket handshake request and starts
      * the corresponding session.
@@ -21,6 +21,8 @@
 #include <exception>
 
 #include "raven/net/WebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/WebSocketOptions.h"
 #include "raven/net/RequestHTTP.h"
 #include "raven/net/ResponseHTTP.h"
 #include "raven/net/Session.h"
@@ -38,13 +40,22 @@ class WebSocketSessionProvider;
  */
 class WebSocketHandler {
 
-    WebSocketController& _controller;
+    const WebSocketControllerBinding _binding;
+    const WebSocketOptions _options;
     std::shared_ptr<Session> _session;
 
 public:
 
     WebSocketHandler(WebSocketController& controller);
 
+    WebSocketHandler(
+        WebSocketController& controller,
+        const WebSocketOptions& options);
+
+    WebSocketHandler(
+        const WebSocketControllerBinding& binding,
+        const WebSocketOptions& options);
+
     /**
      * Handles the specified web socket handshake request.
      * 
@@ -61,8 +72,17 @@ public:
 
     void processError(const std::exception& ex);
 
+    /**
+     * Notifies the controller that the session of this handler has
+     * exceeded a slow consumer threshold and shuts down the connection
+     * if eviction is enabled. Only called by the writer thread.
+     */
+    void onSlowConsumer();
+
     std::shared_ptr<Session> getSession();
 
+    const WebSocketOptions& getOptions() const;
+
     void setSession(std::shared_ptr<Session> session);
 
 }; // END CLASS WebSocketHandler
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Raven Computing
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef RAVEN_NET_WEB_SOCKET_OPTIONS_H
+#define RAVEN_NET_WEB_SOCKET_OPTIONS_H
+
+#include <cstddef>
+#include <chrono>
+
+
+namespace raven {
+namespace net {
+
+/**
+ * Enumeration for all supported actions to take when a client
+ * exceeds the inbound rate limits of its web socket session.
+ */
+enum class RateLimitAction {
+    //Delay reading from the connection until the budget is available again
+    PAUSE,
+    //Discard excess messages without passing them to the controller
+    DROP,
+    //Close the session
+    CLOSE
+};
+
+/**
+ * Configuration options for web socket connections established
+ * through a specific web socket route. A default-constructed
+ * WebSocketOptions object represents the default behaviour.
+ */
+struct WebSocketOptions {
+
+    /**
+     * Enables resumable sessions. When enabled, every outbound message
+     * of a session is assigned an implicit sequence number when it is
+     * written to the connection, starting at 1 for the first message
+     * received by the client. Control messages are not numbered. The most
+     * recent messages are kept in a bounded replay buffer, as are messages
+     * not written yet. When the connection drops, the session is
+     * kept for the duration of the grace period. A client can resume it by
+     * opening a new connection to the same URI path and specifying the
+     * query parameters 'resumeToken' and 'lastSeq'. The resumed session
+     * keeps its ID and the client receives all messages with a sequence
+     * number greater than 'lastSeq'.
+     */
+    bool resumable = false;
+
+    /**
+     * The maximum number of outbound messages kept for replay
+     * by a resumable session.
+     */
+    std::size_t replayBufferSize = 1024;
+
+    /**
+     * The duration for which a disconnected resumable session
+     * can still be resumed.
+     */
+    std::chrono::milliseconds resumeGracePeriod = std::chrono::seconds(30);
+
+    /**
+     * The maximum sustained number of inbound messages per second
+     * accepted from a single session. A value of zero disables the limit.
+     * Control frames, i.e. close, ping and pong, are not counted.
+     */
+    double inboundMessageRate = 0;
+
+    /**
+     * The maximum number of inbound messages a single session can send
+     * in a burst. A value of zero means that the burst is equal to
+     * the message rate, but at least one message.
+     */
+    std::size_t inboundMessageBurst = 0;
+
+    /**
+     * The maximum sustained number of inbound payload bytes per second
+     * accepted from a single session. A value of zero disables the limit.
+     */
+    double inboundByteRate = 0;
+
+    /**
+     * The maximum number of inbound payload bytes a single session can
+     * send in a burst. A value of zero means that the burst is equal to
+     * the byte rate. Unless the PAUSE action is used, a single message
+     * larger than the burst always exceeds the limit.
+     */
+    std::size_t inboundByteBurst = 0;
+
+    /**
+     * The action to take when a session exceeds its inbound rate limits.
+     */
+    RateLimitAction rateLimitAction = RateLimitAction::PAUSE;
+
+    /**
+     * The maximum time the oldest pending outbound message of a session
+     * may wait in its queue before the session is considered a slow
+     * consumer. A value of zero disables this threshold.
+     */
+    std::chrono::milliseconds slowConsumerQueueAge = std::chrono::milliseconds(0);
+
+    /**
+     * The maximum number of pending outbound messages of a session before
+     * the session is considered a slow consumer. A value of zero disables
+     * this threshold.
+     */
+    std::size_t slowConsumerQueueDepth = 0;
+
+    /**
+     * Enables the automatic eviction of slow consumers. When enabled,
+     * the connection of a session is shut down as soon as it exceeds
+     * one of the slow consumer thresholds, and all messages sent to
+     * the session afterwards are dropped.
+     */
+    bool evictSlowConsumers = false;
+
+    /**
+     * The size in bytes of the binary messages into which a file is split
+     * when it is sent with Session::sendFile().
+     */
+    std::size_t fileChunkSize = 64 * 1024;
+
+    /**
+     * The maximum number of messages of a single file transfer which can
+     * be pending in the outbound queue of a session at the same time.
+     * The next message of the file is only queued when a pending one has
+     * been written, so that a transfer never floods the queue.
+     */
+    std::size_t fileChunkWindow = 4;
+
+}; // END STRUCT WebSocketOptions
+
+} // END NAMESPACE net
+} // END NAMESPACE raven
+
+#endif // RAVEN_NET_WEB_SOCKET_OPTIONS_H
@@ -0,0 +1,240 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <functional>
+
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+
+#include "raven/net/MethodHTTP.h"
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/RouteOptions.h"
+
+#include "TestServerHTTP.h"
+
+using raven::net::MethodHTTP;
+using raven::net::RequestHTTP;
+using raven::net::ResponseHTTP;
+using raven::net::RouteOptions;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+
+TEST(BasicRouterHTTPTest, TestPathParameters){
+    auto router = std::make_shared<TestRouterHTTP>([](TestRouterHTTP& r){
+        r.staticRoute(
+            "/users/{id}/files/*path",
+            [](RequestHTTP& request, ResponseHTTP& response){
+                response.body(
+                    std::string(request.getPathParam("id")) + "|"
+                    + std::string(request.getPathParam("path")) + "|"
+                    + std::string(request.getPathParam("missing")));
+            });
+        r.staticRoute(
+            "/users/me",
+            [](RequestHTTP& request, ResponseHTTP& response){
+                response.body(
+                    std::to_string(request.getPathParams().size()));
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    EXPECT_EQ(
+        server.send(HTTPRequest::HTTP_GET, "/users/42/files/a/b.txt?x=1", response),
+        "42|a/b.txt|");
+
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+    //Literal routes have no path parameters
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/users/me", response), "0");
+    server.send(HTTPRequest::HTTP_GET, "/users/42", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_NOT_FOUND);
+}
+
+/**
+ * Returns a route handler which answers with the specified text.
+ */
+static std::function<void(RequestHTTP&, ResponseHTTP&)> reply(
+    const std::string& text){
+
+    return [text](RequestHTTP& request, ResponseHTTP& response){
+        response.body(text);
+    };
+}
+
+TEST(BasicRouterHTTPTest, TestMethodRoutes){
+    auto router = std::make_shared<TestRouterHTTP>([](TestRouterHTTP& r){
+        r.staticRoute(MethodHTTP::HTTP_GET, "/items", reply("list"));
+        r.staticRoute(MethodHTTP::HTTP_POST, "/items", reply("create"));
+        r.staticRoute(MethodHTTP::HTTP_DELETE, "/items/{id}", reply("delete"));
+        r.staticRoute("/items/{id}", reply("any"));
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/items", response), "list");
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_POST, "/items", response), "create");
+    EXPECT_EQ(
+        server.send(HTTPRequest::HTTP_DELETE, "/items/1", response), "delete");
+
+    //The route without a method handles all other methods
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/items/1", response), "any");
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_PUT, "/items/1", response), "any");
+    EXPECT_EQ(server.send("PROPFIND", "/items/1", response), "any");
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+}
+
+TEST(BasicRouterHTTPTest, TestMethodNotAllowed){
+    auto router = std::make_shared<TestRouterHTTP>([](TestRouterHTTP& r){
+        r.staticRoute(MethodHTTP::HTTP_POST, "/items", reply("create"));
+        r.staticRoute(MethodHTTP::HTTP_GET, "/items", reply("list"));
+        r.staticRoute(MethodHTTP::HTTP_PUT, "/items/{id}", reply("update"));
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    server.send(HTTPRequest::HTTP_DELETE, "/items", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+    //Listed in the order of MethodHTTP, including the implicit HEAD route
+    EXPECT_EQ(response.get("Allow", ""), "GET, HEAD, POST");
+
+    server.send("PROPFIND", "/items", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    server.send(HTTPRequest::HTTP_GET, "/items/1", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+    EXPECT_EQ(response.get("Allow", ""), "PUT");
+
+    server.send(HTTPRequest::HTTP_GET, "/unknown", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_NOT_FOUND);
+}
+
+TEST(BasicRouterHTTPTest, TestHeadRequests){
+    int gets = 0;
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.staticRoute(
+            MethodHTTP::HTTP_GET,
+            "/implicit",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                ++gets;
+                response.body("content");
+            });
+        r.staticRoute(MethodHTTP::HTTP_GET, "/explicit", reply("content"));
+        r.staticRoute(
+            MethodHTTP::HTTP_HEAD,
+            "/explicit",
+            [](RequestHTTP& request, ResponseHTTP& response){
+                response.setHeader("X-Head", "true");
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    //Answered by the GET route, without a body
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_HEAD, "/implicit", response), "");
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+    EXPECT_EQ(gets, 1);
+
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_HEAD, "/explicit", response), "");
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+    EXPECT_EQ(response.get("X-Head", ""), "true");
+
+    server.send(HTTPRequest::HTTP_POST, "/explicit", response);
+    EXPECT_EQ(response.get("Allow", ""), "GET, HEAD");
+}
+
+TEST(BasicRouterHTTPTest, TestLiteralRoutesTakePriority){
+    auto router = std::make_shared<TestRouterHTTP>([](TestRouterHTTP& r){
+        r.staticRoute("/users/{id}", reply("pattern"));
+        r.staticRoute("/users/me", reply("literal"));
+        r.staticRoute("/files/*path", reply("wildcard"));
+        r.staticRoute(MethodHTTP::HTTP_GET, "/files/readme", reply("readme"));
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/users/me", response), "literal");
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/users/42", response), "pattern");
+    EXPECT_EQ(
+        server.send(HTTPRequest::HTTP_GET, "/files/readme", response), "readme");
+
+    EXPECT_EQ(
+        server.send(HTTPRequest::HTTP_GET, "/files/other", response), "wildcard");
+
+    //A literal route does not fall back to a pattern for other methods
+    server.send(HTTPRequest::HTTP_POST, "/files/readme", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+}
+
+/**
+ * Defines the routes '/body' and '/stream' with a body size limit of
+ * 8 bytes. Both answer with the received body and count their calls.
+ */
+static std::shared_ptr<TestRouterHTTP> limitedRoutes(int& calls){
+    return std::make_shared<TestRouterHTTP>([&calls](TestRouterHTTP& r){
+        RouteOptions options;
+        options.maxBodySize = 8;
+        r.staticRoute(
+            "/body",
+            [&calls](RequestHTTP& request, ResponseHTTP& response){
+                ++calls;
+                response.body(request.body());
+            },
+            options);
+        r.staticRoute(
+            "/stream",
+            [&calls](RequestHTTP& request, ResponseHTTP& response){
+                ++calls;
+                std::string body;
+                char buffer[3];
+                std::size_t n = 0;
+                while((n = request.readBody(buffer, sizeof(buffer))) > 0){
+                    body.append(buffer, n);
+                }
+                response.body(body);
+            },
+            options);
+    });
+}
+
+TEST(BasicRouterHTTPTest, TestPayloadTooLarge){
+    int calls = 0;
+    TestServerHTTP server(limitedRoutes(calls));
+    HTTPResponse response;
+    EXPECT_EQ(
+        server.send(HTTPRequest::HTTP_POST, "/body", "12345678", response),
+        "12345678");
+
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+    EXPECT_EQ(calls, 1);
+
+    //Rejected by the declared length, before the controller is called
+    server.send(HTTPRequest::HTTP_POST, "/body", "123456789", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_REQUEST_ENTITY_TOO_LARGE);
+    EXPECT_EQ(response.get("Connection", ""), "close");
+    server.send(HTTPRequest::HTTP_POST, "/stream", "123456789", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_REQUEST_ENTITY_TOO_LARGE);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(BasicRouterHTTPTest, TestChunkedPayloadTooLarge){
+    int calls = 0;
+    TestServerHTTP server(limitedRoutes(calls));
+    for(const std::string uri : {"/body", "/stream"}){
+        HTTPRequest request(HTTPRequest::HTTP_POST, uri, HTTPRequest::HTTP_1_1);
+        request.setChunkedTransferEncoding(true);
+        HTTPResponse response;
+        EXPECT_EQ(server.send(request, "12345678", response), "12345678");
+        EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+
+        //Detected while the body is read by the controller
+        HTTPRequest exceeding(
+            HTTPRequest::HTTP_POST, uri, HTTPRequest::HTTP_1_1);
+
+        exceeding.setChunkedTransferEncoding(true);
+        server.send(exceeding, "123456789", response);
+        EXPECT_EQ(
+            response.getStatus(), HTTPResponse::HTTP_REQUEST_ENTITY_TOO_LARGE);
+    }
+    EXPECT_EQ(calls, 4);
+}
@@ -0,0 +1,193 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "raven/net/BroadcastBus.h"
+
+using raven::net::BroadcastBus;
+
+typedef std::pair<std::string, std::string> Delivery;
+
+/**
+ * Records all messages delivered by the bus instead of
+ * sending them to the sessions of the SessionHandler.
+ */
+class TestBroadcastBus : public BroadcastBus {
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<Delivery> _delivered;
+
+public:
+
+    TestBroadcastBus(const std::string& name, std::size_t slotSize)
+        :BroadcastBus(name, 16, slotSize){ }
+
+    ~TestBroadcastBus(){
+        stop();
+    }
+
+    std::vector<Delivery> awaitDelivered(std::size_t count){
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, std::chrono::seconds(5), [&]{
+            return _delivered.size() >= count;
+        });
+        return _delivered;
+    }
+
+    std::vector<Delivery> awaitMessage(const std::string& message){
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, std::chrono::seconds(5), [&]{
+            return !_delivered.empty() && _delivered.back().second == message;
+        });
+        return _delivered;
+    }
+
+protected:
+
+    void deliver(
+        const std::string& group,
+        const std::string& message) override {
+
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _delivered.emplace_back(group, message);
+        _cv.notify_all();
+    }
+};
+
+static std::string uniqueBusName(const std::string& test){
+    return "test-" + test + "-" + std::to_string(getpid());
+}
+
+TEST(BroadcastBusTest, TestPublishIsDeliveredToOtherBus){
+    const std::string name = uniqueBusName("deliver");
+    TestBroadcastBus first(name, 64);
+    TestBroadcastBus second(name, 64);
+    first.start();
+    second.start();
+    EXPECT_TRUE(first.isRunning());
+    EXPECT_TRUE(second.isRunning());
+
+    EXPECT_TRUE(first.publish("hello"));
+    EXPECT_TRUE(first.publish("group.a", "to group"));
+    EXPECT_TRUE(second.publish("reply"));
+
+    const std::vector<Delivery> expected{
+        {"", "hello"}, {"group.a", "to group"}, {"", "reply"}};
+
+    //Each bus receives its own messages once, directly on publish.
+    //Local and remote messages are delivered by different threads
+    EXPECT_THAT(
+        first.awaitDelivered(3),
+        ::testing::UnorderedElementsAreArray(expected));
+
+    EXPECT_THAT(
+        second.awaitDelivered(3),
+        ::testing::UnorderedElementsAreArray(expected));
+
+    EXPECT_EQ(first.getLostMessages(), 0u);
+    EXPECT_EQ(second.getLostMessages(), 0u);
+}
+
+TEST(BroadcastBusTest, TestStartedBusReceivesOnlyNewMessages){
+    const std::string name = uniqueBusName("late");
+    TestBroadcastBus first(name, 64);
+    TestBroadcastBus second(name, 64);
+    first.start();
+    EXPECT_TRUE(first.publish("early"));
+    second.start();
+    EXPECT_TRUE(first.publish("late"));
+
+    const std::vector<Delivery> expected{{"", "late"}};
+    EXPECT_EQ(second.awaitDelivered(1), expected);
+}
+
+TEST(BroadcastBusTest, TestPublishRejectsInvalidMessages){
+    TestBroadcastBus bus(uniqueBusName("reject"), 8);
+    EXPECT_FALSE(bus.publish("stopped"));
+    bus.start();
+    EXPECT_TRUE(bus.publish("12345678"));
+    EXPECT_FALSE(bus.publish("123456789"));
+    EXPECT_FALSE(bus.publish("group", "1234"));
+    bus.stop();
+    EXPECT_FALSE(bus.isRunning());
+    EXPECT_FALSE(bus.publish("stopped"));
+}
+
+TEST(BroadcastBusTest, TestConcurrentPublishersDoNotTearMessages){
+    const std::string name = uniqueBusName("concurrent");
+    TestBroadcastBus first(name, 64);
+    TestBroadcastBus second(name, 64);
+    first.start();
+    second.start();
+    //The publishers lap the ring of 16 slots many times
+    std::vector<std::thread> publishers;
+    for(char c = 'a'; c < 'e'; ++c){
+        publishers.emplace_back([&first, c]{
+            for(int i = 0; i < 2000; ++i){
+                first.publish(std::string(32 + (i % 32), c));
+            }
+        });
+    }
+    for(std::thread& publisher : publishers){
+        publisher.join();
+    }
+    ASSERT_TRUE(first.publish("done"));
+    const std::vector<Delivery> delivered = second.awaitMessage("done");
+    ASSERT_FALSE(delivered.empty());
+    EXPECT_EQ(delivered.back().second, "done");
+    //Each message consists of a single character repeated
+    std::size_t torn = 0;
+    for(std::size_t i = 0; i + 1 < delivered.size(); ++i){
+        const std::string& message = delivered[i].second;
+        if(message.find_first_not_of(message[0]) != std::string::npos){
+            ++torn;
+        }
+    }
+    EXPECT_EQ(torn, 0u);
+}
+
+TEST(BroadcastBusTest, TestConfigurationMismatchThrows){
+    const std::string name = uniqueBusName("mismatch");
+    TestBroadcastBus first(name, 64);
+    TestBroadcastBus second(name, 128);
+    first.start();
+    EXPECT_THROW(second.start(), std::runtime_error);
+    EXPECT_FALSE(second.isRunning());
+    EXPECT_TRUE(first.publish("still usable"));
+}
+
+TEST(BroadcastBusTest, TestLastUserRemovesRegion){
+    const std::string name = uniqueBusName("remove");
+    TestBroadcastBus first(name, 64);
+    TestBroadcastBus second(name, 64);
+    TestBroadcastBus other(name, 128);
+    first.start();
+    second.start();
+    first.stop();
+    //Still in use by the second bus
+    EXPECT_THROW(other.start(), std::runtime_error);
+    second.stop();
+    //The region was removed, so it can be created with another configuration
+    EXPECT_NO_THROW(other.start());
+    EXPECT_TRUE(other.isRunning());
+}
+
+TEST(BroadcastBusTest, TestInvalidConfigurationThrows){
+    EXPECT_THROW(BroadcastBus(""), std::runtime_error);
+    EXPECT_THROW(BroadcastBus("a/b"), std::runtime_error);
+    EXPECT_THROW(BroadcastBus("bus", 3, 64), std::runtime_error);
+    EXPECT_THROW(BroadcastBus("bus", 16, 0), std::runtime_error);
+}
@@ -0,0 +1,133 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdlib>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/net/WebSocketOptions.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::MessagePriority;
+using raven::net::SendStatus;
+using raven::net::WebSocketOptions;
+
+/**
+ * Provides a directory for the files to send and a Session with a
+ * small chunk size. The test provider completes every chunk right away,
+ * so each transfer has finished when sendFile() returns.
+ */
+class FileTransferTest : public ::testing::Test {
+protected:
+
+    std::string directory;
+    std::shared_ptr<TestSessionProvider> provider;
+    std::shared_ptr<Session> session;
+    std::vector<std::pair<std::size_t, std::size_t>> progress;
+    std::vector<SendStatus> completions;
+
+    void SetUp() override {
+        std::string path =
+            (std::filesystem::temp_directory_path() / "ft-XXXXXX").string();
+
+        ASSERT_NE(mkdtemp(&path[0]), nullptr);
+        directory = path;
+        WebSocketOptions options;
+        options.fileChunkSize = 4;
+        options.fileChunkWindow = 2;
+        provider = std::make_shared<TestSessionProvider>(options);
+        session = std::make_shared<Session>(provider);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::string createFile(const std::string& name, const std::string& data){
+        const std::string path = directory + "/" + name;
+        std::ofstream file(path, std::ios::binary);
+        file << data;
+        return path;
+    }
+
+    void sendFile(const std::string& path){
+        session->sendFile(
+            path,
+            MessagePriority::BULK,
+            [this](std::size_t written, std::size_t total){
+                progress.emplace_back(written, total);
+            },
+            [this](SendStatus status, std::size_t depth){
+                completions.push_back(status);
+            });
+    }
+};
+
+TEST_F(FileTransferTest, TestChunksAndProgress){
+    sendFile(createFile("data.bin", "abcdefghij"));
+    EXPECT_EQ(provider->getSent(),
+              (std::vector<std::string>{"abcd", "efgh", "ij"}));
+
+    EXPECT_EQ(provider->getPriorities(),
+              std::vector<MessagePriority>(3, MessagePriority::BULK));
+
+    ASSERT_NE(provider->lastMessage, nullptr);
+    EXPECT_TRUE(provider->lastMessage->isBinary());
+    EXPECT_EQ(progress, (std::vector<std::pair<std::size_t, std::size_t>>{
+        {4, 10}, {8, 10}, {10, 10}}));
+
+    EXPECT_EQ(completions, std::vector<SendStatus>{SendStatus::WRITTEN});
+}
+
+TEST_F(FileTransferTest, TestChunkSizeMultiple){
+    sendFile(createFile("data.bin", "abcdefgh"));
+    EXPECT_EQ(provider->getSent(), (std::vector<std::string>{"abcd", "efgh"}));
+    ASSERT_FALSE(progress.empty());
+    EXPECT_EQ(progress.back(), (std::pair<std::size_t, std::size_t>{8, 8}));
+    EXPECT_EQ(completions, std::vector<SendStatus>{SendStatus::WRITTEN});
+}
+
+TEST_F(FileTransferTest, TestEmptyFile){
+    sendFile(createFile("empty.bin", ""));
+    //The client still receives a single empty message
+    EXPECT_EQ(provider->getSent(), std::vector<std::string>{""});
+    ASSERT_NE(provider->lastMessage, nullptr);
+    EXPECT_TRUE(provider->lastMessage->isBinary());
+    EXPECT_EQ(progress, (std::vector<std::pair<std::size_t, std::size_t>>{
+        {0, 0}}));
+
+    EXPECT_EQ(completions, std::vector<SendStatus>{SendStatus::WRITTEN});
+}
+
+TEST_F(FileTransferTest, TestMissingFile){
+    EXPECT_THROW(sendFile(directory + "/missing.bin"), std::runtime_error);
+    EXPECT_THROW(sendFile(directory), std::runtime_error);
+    EXPECT_TRUE(provider->getSent().empty());
+    EXPECT_TRUE(completions.empty());
+}
+
+TEST_F(FileTransferTest, TestAbortOnFirstUnwrittenChunk){
+    const std::string path = createFile("data.bin", "abcdefghij");
+    for(SendStatus status : {SendStatus::DROPPED, SendStatus::BUFFERED}){
+        provider->status = status;
+        const std::size_t sent = provider->getSent().size();
+        completions.clear();
+        sendFile(path);
+        //No further chunks are queued after the first one has failed
+        EXPECT_EQ(provider->getSent().size(), sent + 1);
+        EXPECT_EQ(completions, std::vector<SendStatus>{status});
+    }
+    EXPECT_TRUE(progress.empty());
+}
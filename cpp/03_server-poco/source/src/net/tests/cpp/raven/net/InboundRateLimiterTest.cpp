@@ -0,0 +1,106 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdint>
+#include <chrono>
+
+#include "Poco/Net/WebSocket.h"
+
+#include "raven/net/InboundRateLimiter.h"
+#include "raven/net/WebSocketOptions.h"
+
+using raven::net::InboundRateLimiter;
+using raven::net::RateLimitDecision;
+using raven::net::RateLimitAction;
+using raven::net::WebSocketOptions;
+using Poco::Net::WebSocket;
+
+static WebSocketOptions messageLimit(RateLimitAction action){
+    WebSocketOptions options;
+    options.inboundMessageRate = 10;
+    options.inboundMessageBurst = 3;
+    options.rateLimitAction = action;
+    return options;
+}
+
+TEST(InboundRateLimiterTest, TestDisabledByDefault){
+    InboundRateLimiter limiter{WebSocketOptions()};
+    EXPECT_FALSE(limiter.isEnabled());
+    for(int i = 0; i < 1000; ++i){
+        EXPECT_EQ(limiter.admit(4096), RateLimitDecision::ACCEPT);
+    }
+}
+
+TEST(InboundRateLimiterTest, TestDropAboveBurst){
+    const std::uint64_t dropped = InboundRateLimiter::droppedMessages;
+    const std::uint64_t throttled = InboundRateLimiter::throttledSessions;
+    InboundRateLimiter limiter(messageLimit(RateLimitAction::DROP));
+    EXPECT_TRUE(limiter.isEnabled());
+    for(int i = 0; i < 3; ++i){
+        EXPECT_EQ(limiter.admit(8), RateLimitDecision::ACCEPT);
+    }
+    EXPECT_EQ(limiter.admit(8), RateLimitDecision::DROP);
+    EXPECT_EQ(limiter.admit(8), RateLimitDecision::DROP);
+    EXPECT_EQ(InboundRateLimiter::droppedMessages, dropped + 2);
+    //A session is only counted once as throttled
+    EXPECT_EQ(InboundRateLimiter::throttledSessions, throttled + 1);
+}
+
+TEST(InboundRateLimiterTest, TestCloseAboveBurst){
+    const std::uint64_t closed = InboundRateLimiter::closedSessions;
+    InboundRateLimiter limiter(messageLimit(RateLimitAction::CLOSE));
+    for(int i = 0; i < 3; ++i){
+        EXPECT_EQ(limiter.admit(8), RateLimitDecision::ACCEPT);
+    }
+    EXPECT_EQ(limiter.admit(8), RateLimitDecision::CLOSE);
+    EXPECT_EQ(InboundRateLimiter::closedSessions, closed + 1);
+}
+
+TEST(InboundRateLimiterTest, TestPauseAboveBurst){
+    const std::uint64_t paused = InboundRateLimiter::pausedMessages;
+    WebSocketOptions options = messageLimit(RateLimitAction::PAUSE);
+    options.inboundMessageRate = 50;
+    options.inboundMessageBurst = 1;
+    InboundRateLimiter limiter(options);
+    EXPECT_EQ(limiter.admit(8), RateLimitDecision::ACCEPT);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(limiter.admit(8), RateLimitDecision::ACCEPT);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    //The second message needs 20ms of budget
+    EXPECT_GE(elapsed, std::chrono::milliseconds(10));
+    EXPECT_EQ(InboundRateLimiter::pausedMessages, paused + 1);
+}
+
+TEST(InboundRateLimiterTest, TestByteBudget){
+    WebSocketOptions options;
+    options.inboundByteRate = 1000;
+    options.inboundByteBurst = 100;
+    options.rateLimitAction = RateLimitAction::DROP;
+    InboundRateLimiter limiter(options);
+    EXPECT_EQ(limiter.admit(60), RateLimitDecision::ACCEPT);
+    EXPECT_EQ(limiter.admit(60), RateLimitDecision::DROP);
+    EXPECT_EQ(limiter.admit(40), RateLimitDecision::ACCEPT);
+    //Larger than the burst, never fits
+    InboundRateLimiter fresh(options);
+    EXPECT_EQ(fresh.admit(101), RateLimitDecision::DROP);
+}
+
+TEST(InboundRateLimiterTest, TestControlFramesExempt){
+    InboundRateLimiter limiter(messageLimit(RateLimitAction::CLOSE));
+    const int text = WebSocket::FRAME_TEXT;
+    const int ping = WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PING;
+    const int pong = WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG;
+    const int close = WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_CLOSE;
+    for(int i = 0; i < 3; ++i){
+        EXPECT_EQ(limiter.admit(text, 8), RateLimitDecision::ACCEPT);
+    }
+    //The data budget is exhausted, control frames still pass
+    for(int i = 0; i < 10; ++i){
+        EXPECT_EQ(limiter.admit(ping, 8), RateLimitDecision::ACCEPT);
+        EXPECT_EQ(limiter.admit(pong, 8), RateLimitDecision::ACCEPT);
+    }
+    EXPECT_EQ(limiter.admit(close, 2), RateLimitDecision::ACCEPT);
+    EXPECT_EQ(limiter.admit(text, 8), RateLimitDecision::CLOSE);
+}
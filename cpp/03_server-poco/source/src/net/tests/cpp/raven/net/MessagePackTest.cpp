@@ -0,0 +1,111 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+#include "raven/net/MessagePackEncoder.h"
+#include "raven/net/MessagePackDecoder.h"
+
+using raven::net::MessagePackEncoder;
+using raven::net::MessagePackDecoder;
+using raven::net::MessagePackType;
+
+/**
+ * Decodes the specified data without its last byte and expects the read
+ * function to throw without changing the read position.
+ */
+template<typename Read>
+static void expectTruncated(const std::string& data, Read read){
+    MessagePackDecoder decoder(std::string_view(data).substr(0, data.size() - 1));
+    ASSERT_THROW(read(decoder), std::runtime_error);
+    ASSERT_EQ(0u, decoder.getPosition());
+    //The decoder is still usable at the start of the value
+    ASSERT_THROW(read(decoder), std::runtime_error);
+    ASSERT_EQ(0u, decoder.getPosition());
+}
+
+TEST(MessagePackTest, TestRoundTrip){
+    MessagePackEncoder encoder;
+    encoder.writeMapHeader(2);
+    encoder.writeString("id");
+    encoder.writeInt(-1000);
+    encoder.writeString("values");
+    encoder.writeArrayHeader(3);
+    encoder.writeDouble(1.5);
+    encoder.writeUInt(UINT64_MAX);
+    encoder.writeBinary("raw");
+    const std::string data = encoder.release();
+    ASSERT_EQ(0u, encoder.size());
+
+    MessagePackDecoder decoder(data);
+    ASSERT_EQ(2u, decoder.readMapHeader());
+    ASSERT_EQ("id", decoder.readString());
+    ASSERT_EQ(-1000, decoder.readInt());
+    ASSERT_EQ("values", decoder.readString());
+    ASSERT_EQ(MessagePackType::ARRAY, decoder.peekType());
+    ASSERT_EQ(3u, decoder.readArrayHeader());
+    ASSERT_EQ(1.5, decoder.readDouble());
+    const std::size_t position = decoder.getPosition();
+    ASSERT_THROW(decoder.readInt(), std::runtime_error);
+    ASSERT_EQ(position, decoder.getPosition());
+    ASSERT_EQ(UINT64_MAX, decoder.readUInt());
+    ASSERT_EQ("raw", decoder.readBinary());
+    ASSERT_FALSE(decoder.hasNext());
+}
+
+TEST(MessagePackTest, TestSkipAndTruncation){
+    MessagePackEncoder encoder;
+    encoder.writeArrayHeader(2);
+    encoder.writeMapHeader(1);
+    encoder.writeString("key");
+    encoder.writeBool(true);
+    encoder.writeNil();
+    encoder.writeString("next");
+    const std::string data = encoder.getData();
+
+    MessagePackDecoder decoder(data);
+    decoder.skip();
+    ASSERT_EQ("next", decoder.readString());
+
+    MessagePackDecoder truncated(std::string_view(data).substr(0, data.size() - 1));
+    truncated.skip();
+    const std::size_t position = truncated.getPosition();
+    ASSERT_THROW(truncated.readString(), std::runtime_error);
+    ASSERT_EQ(position, truncated.getPosition());
+}
+
+TEST(MessagePackTest, TestTruncatedValuesKeepPosition){
+    MessagePackEncoder encoder;
+    encoder.writeInt(-100000);
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readInt(); });
+    encoder.writeUInt(100000);
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readUInt(); });
+    encoder.writeDouble(0.1);
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readDouble(); });
+    encoder.writeString("text");
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readString(); });
+    encoder.writeString(std::string(300, 's'));
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readString(); });
+    encoder.writeBinary("bytes");
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readBinary(); });
+    encoder.writeArrayHeader(70000);
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readArrayHeader(); });
+    encoder.writeMapHeader(70000);
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.readMapHeader(); });
+}
+
+TEST(MessagePackTest, TestTruncatedContainerSkipKeepsPosition){
+    MessagePackEncoder encoder;
+    encoder.writeArrayHeader(3);
+    encoder.writeInt(1);
+    encoder.writeString("nested");
+    encoder.writeArrayHeader(1);
+    encoder.writeString("last");
+    expectTruncated(encoder.release(), [](MessagePackDecoder& d){ d.skip(); });
+}
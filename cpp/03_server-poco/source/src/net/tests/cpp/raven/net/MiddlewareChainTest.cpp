@@ -0,0 +1,125 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+
+#include "raven/net/MethodHTTP.h"
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/MiddlewareChain.h"
+
+#include "TestServerHTTP.h"
+
+using raven::net::MethodHTTP;
+using raven::net::RequestHTTP;
+using raven::net::ResponseHTTP;
+using raven::net::MiddlewareChain;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+
+TEST(MiddlewareChainTest, TestExecutionOrder){
+    std::vector<std::string> events;
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.middleware([&](RequestHTTP& request, ResponseHTTP& response,
+                         MiddlewareChain& chain){
+            events.push_back("outer>");
+            chain.proceed(request, response);
+            events.push_back("<outer");
+        });
+        r.middleware([&](RequestHTTP& request, ResponseHTTP& response,
+                         MiddlewareChain& chain){
+            events.push_back("inner>");
+            chain.proceed(request, response);
+            events.push_back("<inner");
+        });
+        r.staticRoute(
+            "/items",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                events.push_back("controller");
+                response.body("items");
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/items", response), "items");
+    EXPECT_EQ(events, (std::vector<std::string>{
+        "outer>", "inner>", "controller", "<inner", "<outer"}));
+}
+
+TEST(MiddlewareChainTest, TestShortCircuit){
+    std::vector<std::string> events;
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.middleware([&](RequestHTTP& request, ResponseHTTP& response,
+                         MiddlewareChain& chain){
+            events.push_back("auth");
+            if(request.getURIpath() == "/private"){
+                response.setStatus(HTTPResponse::HTTP_FORBIDDEN)
+                        .body("denied");
+                return;
+            }
+            chain.proceed(request, response);
+        });
+        r.middleware([&](RequestHTTP& request, ResponseHTTP& response,
+                         MiddlewareChain& chain){
+            events.push_back("log");
+            chain.proceed(request, response);
+        });
+        r.staticRoute(
+            "/private",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                events.push_back("controller");
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    EXPECT_EQ(server.send(HTTPRequest::HTTP_GET, "/private", response), "denied");
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_FORBIDDEN);
+    //Neither the following middleware nor the controller is called
+    EXPECT_EQ(events, std::vector<std::string>{"auth"});
+}
+
+TEST(MiddlewareChainTest, TestMiddlewareAfterInitialize){
+    auto router = std::make_shared<TestRouterHTTP>([](TestRouterHTTP& r){ });
+    TestServerHTTP server(router);
+    EXPECT_THROW(
+        router->middleware([](RequestHTTP& request, ResponseHTTP& response,
+                              MiddlewareChain& chain){ }),
+        std::runtime_error);
+}
+
+TEST(MiddlewareChainTest, TestRunsBeforeErrorHandling){
+    std::vector<std::string> paths;
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.middleware([&](RequestHTTP& request, ResponseHTTP& response,
+                         MiddlewareChain& chain){
+            paths.push_back(request.getURIpath());
+            response.setHeader("X-Middleware", "true");
+            chain.proceed(request, response);
+        });
+        r.staticRoute(
+            MethodHTTP::HTTP_GET,
+            "/items",
+            [](RequestHTTP& request, ResponseHTTP& response){
+                response.body("items");
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    server.send(HTTPRequest::HTTP_GET, "/unknown", response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_NOT_FOUND);
+    EXPECT_EQ(response.get("X-Middleware", ""), "true");
+
+    HTTPResponse notAllowed;
+    server.send(HTTPRequest::HTTP_POST, "/items", notAllowed);
+    EXPECT_EQ(notAllowed.getStatus(), HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+    EXPECT_EQ(notAllowed.get("X-Middleware", ""), "true");
+    EXPECT_EQ(paths, (std::vector<std::string>{"/unknown", "/items"}));
+}
@@ -0,0 +1,173 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdlib>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/MultipartParser.h"
+#include "raven/net/MultipartFileSink.h"
+
+#include "TestServerHTTP.h"
+
+using raven::net::RequestHTTP;
+using raven::net::ResponseHTTP;
+using raven::net::MultipartParser;
+using raven::net::MultipartFileSink;
+using raven::net::MultipartFile;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+
+static const std::string BODY =
+    "--xyz\r\n"
+    "Content-Disposition: form-data; name=\"title\"\r\n\r\n"
+    "hello\r\n"
+    "--xyz\r\n"
+    "Content-Disposition: form-data; name=\"file\"; filename=\"../a.txt\"\r\n"
+    "Content-Type: text/plain\r\n\r\n"
+    "first\r\nfile\r\n"
+    "--xyz\r\n"
+    "Content-Disposition: form-data; name=\"empty\"; filename=\"b.txt\"\r\n\r\n"
+    "\r\n"
+    "--xyz--\r\n";
+
+/**
+ * Provides an empty directory for the files written by a sink.
+ */
+class MultipartFileSinkTest : public ::testing::Test {
+protected:
+
+    std::string directory;
+
+    void SetUp() override {
+        std::string path =
+            (std::filesystem::temp_directory_path() / "mfs-XXXXXX").string();
+
+        ASSERT_NE(mkdtemp(&path[0]), nullptr);
+        directory = path;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::size_t countFiles(){
+        return static_cast<std::size_t>(std::distance(
+            std::filesystem::directory_iterator(directory),
+            std::filesystem::directory_iterator()));
+    }
+
+    /**
+     * Posts the specified multipart body to a route which parses
+     * it into the specified sink.
+     * 
+     * @return True if the body was parsed successfully.
+     */
+    bool post(const std::string& body, MultipartFileSink& sink){
+        bool parsed = false;
+        auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+            r.staticRoute(
+                "/upload",
+                [&](RequestHTTP& request, ResponseHTTP& response){
+                    try{
+                        MultipartParser::parse(request, sink);
+                        parsed = true;
+                    }catch(const std::runtime_error&){
+                        parsed = false;
+                    }
+                });
+        });
+        TestServerHTTP server(router);
+        HTTPRequest request(
+            HTTPRequest::HTTP_POST, "/upload", HTTPRequest::HTTP_1_1);
+
+        request.set("Content-Type", "multipart/form-data; boundary=xyz");
+        request.setContentLength(static_cast<std::streamsize>(body.size()));
+        HTTPResponse response;
+        server.send(request, body, response);
+        return parsed;
+    }
+};
+
+static std::string readFile(const std::string& path){
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream out;
+    out << in.rdbuf();
+    return out.str();
+}
+
+TEST_F(MultipartFileSinkTest, TestWritesFilesAndFields){
+    MultipartFileSink sink(directory);
+    ASSERT_TRUE(post(BODY, sink));
+
+    EXPECT_EQ(sink.getFields().get("title", ""), "hello");
+    EXPECT_FALSE(sink.getFields().has("file"));
+    const auto& files = sink.getFiles();
+    ASSERT_EQ(files.size(), 2u);
+    EXPECT_EQ(countFiles(), 2u);
+
+    //The name given by the client is never used as a path
+    EXPECT_EQ(files[0].part.filename, "../a.txt");
+    EXPECT_EQ(std::filesystem::path(files[0].path).parent_path(), directory);
+    EXPECT_EQ(files[0].size, 11u);
+    EXPECT_EQ(std::filesystem::file_size(files[0].path), 11u);
+    EXPECT_EQ(readFile(files[0].path), "first\r\nfile");
+
+    EXPECT_EQ(files[1].part.name, "empty");
+    EXPECT_EQ(files[1].size, 0u);
+    EXPECT_TRUE(std::filesystem::exists(files[1].path));
+    EXPECT_NE(files[0].path, files[1].path);
+
+    sink.removeFiles();
+    EXPECT_TRUE(sink.getFiles().empty());
+    EXPECT_EQ(countFiles(), 0u);
+}
+
+TEST_F(MultipartFileSinkTest, TestFieldSizeLimit){
+    MultipartFileSink sink(directory, 5);
+    ASSERT_TRUE(post(BODY, sink));
+    EXPECT_EQ(sink.getFields().get("title", ""), "hello");
+    sink.removeFiles();
+
+    const std::string body =
+        "--xyz\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"a.txt\"\r\n\r\n"
+        "content\r\n"
+        "--xyz\r\n"
+        "Content-Disposition: form-data; name=\"title\"\r\n\r\n"
+        "longer\r\n"
+        "--xyz--\r\n";
+
+    MultipartFileSink limited(directory, 5);
+    EXPECT_FALSE(post(body, limited));
+    //The file written before the field was rejected is removed
+    EXPECT_TRUE(limited.getFiles().empty());
+    EXPECT_EQ(countFiles(), 0u);
+}
+
+TEST_F(MultipartFileSinkTest, TestFilesAreRemovedOnAbort){
+    MultipartFileSink sink(directory);
+    //The final boundary is missing
+    EXPECT_FALSE(post(BODY.substr(0, BODY.size() - 20), sink));
+    EXPECT_TRUE(sink.getFiles().empty());
+    EXPECT_EQ(countFiles(), 0u);
+}
+
+TEST_F(MultipartFileSinkTest, TestMissingDirectory){
+    MultipartFileSink sink(directory + "/missing");
+    EXPECT_FALSE(post(BODY, sink));
+    EXPECT_TRUE(sink.getFiles().empty());
+}
@@ -0,0 +1,64 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+#include "raven/net/MultipartParser.h"
+
+using raven::net::MultipartParser;
+using raven::net::MultipartHandler;
+using raven::net::MultipartPart;
+
+/**
+ * Records all parts passed to it as a single string.
+ */
+class RecordingMultipartHandler : public MultipartHandler {
+public:
+    std::string record;
+    void onPartBegin(const MultipartPart& part) override {
+        record += "[" + part.name + "|" + part.filename + "]";
+    }
+    void onPartData(std::string_view data) override {
+        record.append(data.data(), data.size());
+    }
+    void onPartEnd() override {
+        record += ";";
+    }
+};
+
+
+TEST(MultipartParserTest, TestSplitChunks){
+    const std::string body =
+        "--xyz\r\n"
+        "Content-Disposition: form-data; name=\"title\"\r\n\r\n"
+        "hello\r\n"
+        "--xyz\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"a;b.txt\"\r\n"
+        "Content-Type: text/plain\r\n\r\n"
+        "line\r\n--xy\r\n"
+        "--xyz--\r\n";
+
+    ASSERT_EQ("xyz", MultipartParser::getBoundary(
+        "multipart/form-data; boundary=\"xyz\""));
+
+    for(std::size_t chunk = 1; chunk <= body.size(); ++chunk){
+        RecordingMultipartHandler handler;
+        MultipartParser parser("xyz", handler);
+        for(std::size_t i = 0; i < body.size(); i += chunk){
+            parser.feed(body.data() + i, std::min(chunk, body.size() - i));
+        }
+        parser.finish();
+        ASSERT_EQ("[title|]hello;[file|a;b.txt]line\r\n--xy;", handler.record);
+    }
+
+    RecordingMultipartHandler handler;
+    MultipartParser truncated("xyz", handler);
+    truncated.feed(body.data(), body.size() / 2);
+    ASSERT_THROW(truncated.finish(), std::runtime_error);
+}
@@ -0,0 +1,323 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <stdexcept>
+
+#include "Poco/Buffer.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NameValueCollection.h"
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/HeaderHTTP.h"
+
+#include "TestServerHTTP.h"
+
+using raven::net::RequestHTTP;
+using raven::net::ResponseHTTP;
+using raven::net::HeaderHTTP;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::NameValueCollection;
+
+/**
+ * Handles a single GET request with the specified function.
+ */
+static void handle(
+    const std::string& uri,
+    std::function<void(RequestHTTP&)> test){
+
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.staticRoute(
+            "/query",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                test(request);
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPResponse response;
+    server.send(HTTPRequest::HTTP_GET, uri, response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+}
+
+/**
+ * Handles a single GET request with the specified Cookie header.
+ */
+static void handleCookies(
+    const std::string& cookies,
+    std::function<void(RequestHTTP&)> test){
+
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.staticRoute(
+            "/cookies",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                test(request);
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPRequest request(HTTPRequest::HTTP_GET, "/cookies", HTTPRequest::HTTP_1_1);
+    request.set("Cookie", cookies);
+    HTTPResponse response;
+    server.send(request, std::string(), response);
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+}
+
+/**
+ * Handles a single POST request with the specified body. If a declared
+ * length is specified, the body is truncated to the actual body.
+ */
+static void handleBody(
+    const std::string& body,
+    std::function<void(RequestHTTP&)> test,
+    std::streamsize declaredLength = -1){
+
+    auto router = std::make_shared<TestRouterHTTP>([&](TestRouterHTTP& r){
+        r.staticRoute(
+            "/body",
+            [&](RequestHTTP& request, ResponseHTTP& response){
+                test(request);
+            });
+    });
+    TestServerHTTP server(router);
+    HTTPRequest request(HTTPRequest::HTTP_POST, "/body", HTTPRequest::HTTP_1_1);
+    HTTPResponse response;
+    if(declaredLength >= 0){
+        request.setContentLength(declaredLength);
+        server.sendTruncated(request, body, response);
+    }else{
+        request.setContentLength(static_cast<std::streamsize>(body.size()));
+        server.send(request, body, response);
+    }
+    EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_OK);
+}
+
+TEST(RequestHTTPTest, TestQuerySlicing){
+    bool handled = false;
+    handle("/query?a=1&&b=2&a=3&flag&empty=&=x&c=4#d=5", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.getURIpathView(), "/query");
+        //The first parameter with a name wins
+        EXPECT_EQ(request.getQueryParam("a"), "1");
+        EXPECT_EQ(request.getQueryParam("b"), "2");
+        EXPECT_EQ(request.getQueryParam("c"), "4");
+        EXPECT_EQ(request.getQueryParam(""), "x");
+        //Parameters without a value are ignored, like by getQueryParams()
+        EXPECT_FALSE(request.hasQueryParam("flag"));
+        EXPECT_FALSE(request.hasQueryParam("empty"));
+        EXPECT_EQ(request.getQueryParam("flag"), "");
+        //The fragment is not part of the query
+        EXPECT_FALSE(request.hasQueryParam("d"));
+        EXPECT_FALSE(request.hasQueryParam("missing"));
+
+        NameValueCollection& params = request.getQueryParams();
+        EXPECT_EQ(params.size(), 5u);
+        EXPECT_EQ(params.get("a"), "1");
+        EXPECT_EQ(params.get("c"), "4");
+        EXPECT_FALSE(params.has("flag"));
+        EXPECT_FALSE(params.has("empty"));
+        for(const auto& param : params){
+            EXPECT_TRUE(request.hasQueryParam(param.first)) << param.first;
+        }
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestQueryWithoutParameters){
+    bool handled = false;
+    handle("/query?", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.getURIpathView(), "/query");
+        EXPECT_FALSE(request.hasQueryParam(""));
+        EXPECT_EQ(request.getQueryParams().size(), 0u);
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestQueryDecoding){
+    bool handled = false;
+    handle("/query?text=a%20b+c&%6Eame=v&bad=%zz%4&plain=xyz", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.getQueryParam("text"), "a b c");
+        //Names are compared in their decoded form
+        EXPECT_EQ(request.getQueryParam("name"), "v");
+        EXPECT_FALSE(request.hasQueryParam("%6Eame"));
+        //Malformed escapes are taken literally
+        EXPECT_EQ(request.getQueryParam("bad"), "%zz%4");
+
+        //Values without escapes are views into the URI
+        const std::string& uri = request.getURI();
+        const std::string_view plain = request.getQueryParam("plain");
+        EXPECT_GE(plain.data(), uri.data());
+        EXPECT_LE(plain.data() + plain.size(), uri.data() + uri.size());
+        //Values are only decoded once
+        const std::string_view text = request.getQueryParam("text");
+        EXPECT_EQ(request.getQueryParam("text").data(), text.data());
+
+        //The collection holds the values as they appear in the URI
+        EXPECT_EQ(request.getQueryParams().get("text"), "a%20b+c");
+        EXPECT_TRUE(request.getQueryParams().has("%6Eame"));
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestModifiedHeaders){
+    bool handled = false;
+    handle("/query", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.getHeader(HeaderHTTP::ACCEPT), "");
+        NameValueCollection& headers = request.getHeaders();
+        headers.add("Accept", "text/plain");
+        EXPECT_EQ(request.getHeader(HeaderHTTP::ACCEPT), "text/plain");
+
+        //Replacing a value does not change the number of headers
+        headers.set("Accept", "application/json");
+        EXPECT_EQ(request.getHeader(HeaderHTTP::ACCEPT), "application/json");
+        EXPECT_EQ(request.getHeader("accept"), "application/json");
+
+        //Erasing one header and adding another keeps the size as well
+        headers.erase("Accept");
+        headers.add("Content-Type", "text/html");
+        EXPECT_EQ(request.getHeader(HeaderHTTP::ACCEPT), "");
+        EXPECT_EQ(request.getHeader(HeaderHTTP::CONTENT_TYPE), "text/html");
+        for(int i = 0; i < 64; ++i){
+            headers.add("X-Filler-" + std::to_string(i), "value");
+        }
+        EXPECT_EQ(request.getHeader(HeaderHTTP::CONTENT_TYPE), "text/html");
+        EXPECT_EQ(request.getHeader("X-Filler-63"), "value");
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestCookieParsing){
+    bool handled = false;
+    handleCookies(
+        "a=1; b=\"quoted value\";  c = spaced ;flag; =anon; d=; e=\"x; a=2",
+        [&](RequestHTTP& request){
+
+        handled = true;
+        //The first cookie with a name wins
+        EXPECT_EQ(request.getCookie("a"), "1");
+        //Surrounding quotes and whitespace are removed
+        EXPECT_EQ(request.getCookie("b"), "quoted value");
+        EXPECT_EQ(request.getCookie("c"), "spaced");
+        //Unbalanced quotes are kept
+        EXPECT_EQ(request.getCookie("e"), "\"x");
+        //Cookies may have an empty value but must have a name
+        EXPECT_TRUE(request.hasCookie("d"));
+        EXPECT_EQ(request.getCookie("d"), "");
+        EXPECT_FALSE(request.hasCookie(""));
+        //Pairs without a value sign are ignored
+        EXPECT_FALSE(request.hasCookie("flag"));
+        //Names are case-sensitive
+        EXPECT_FALSE(request.hasCookie("A"));
+        EXPECT_EQ(request.getCookie("missing"), "");
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestWithoutCookies){
+    bool handled = false;
+    handle("/query", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_FALSE(request.hasCookie("a"));
+        EXPECT_EQ(request.getCookie("a"), "");
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestModifiedCookieHeader){
+    bool handled = false;
+    handleCookies("a=1; b=2", [&](RequestHTTP& request){
+        handled = true;
+        NameValueCollection& headers = request.getHeaders();
+        EXPECT_EQ(request.getCookie("a"), "1");
+        //A longer value releases the memory of the previous value
+        headers.set("Cookie", "a=" + std::string(256, 'x') + "; c=3");
+        EXPECT_EQ(request.getCookie("a"), std::string(256, 'x'));
+        EXPECT_EQ(request.getCookie("c"), "3");
+        EXPECT_FALSE(request.hasCookie("b"));
+        headers.erase("Cookie");
+        EXPECT_FALSE(request.hasCookie("a"));
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestReadBodyAfterBody){
+    bool handled = false;
+    handleBody("abcdefg", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.body(), "abcdefg");
+        //Reads from the buffered body
+        char buffer[4];
+        ASSERT_EQ(request.readBody(buffer, sizeof(buffer)), 4u);
+        EXPECT_EQ(std::string(buffer, 4), "abcd");
+        ASSERT_EQ(request.readBody(buffer, sizeof(buffer)), 3u);
+        EXPECT_EQ(std::string(buffer, 3), "efg");
+        EXPECT_EQ(request.readBody(buffer, sizeof(buffer)), 0u);
+        //The buffered body is still available
+        EXPECT_EQ(request.body(), "abcdefg");
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestBodyAfterReadBody){
+    bool handled = false;
+    handleBody("abcdefg", [&](RequestHTTP& request){
+        handled = true;
+        char buffer[4];
+        ASSERT_EQ(request.readBody(buffer, sizeof(buffer)), 4u);
+        //The consumed part of the body is gone
+        EXPECT_THROW(request.body(), std::runtime_error);
+        EXPECT_THROW(request.bodyRaw(), std::runtime_error);
+        EXPECT_THROW(request.bodyView(), std::runtime_error);
+        ASSERT_EQ(request.readBody(buffer, sizeof(buffer)), 3u);
+        EXPECT_EQ(std::string(buffer, 3), "efg");
+    });
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestInitialBodyAllocationIsCapped){
+    bool handled = false;
+    //Declares a length far larger than the body which is actually sent
+    handleBody("hello", [&](RequestHTTP& request){
+        handled = true;
+        EXPECT_EQ(request.getContentLength(), 1 << 30);
+        Poco::Buffer<char>& body = request.bodyRaw();
+        EXPECT_EQ(std::string(body.begin(), body.size()), "hello");
+        EXPECT_LE(body.capacity(), 64u * 1024u);
+    }, 1 << 30);
+    EXPECT_TRUE(handled);
+}
+
+TEST(RequestHTTPTest, TestBodyViewAliasesBody){
+    int handled = 0;
+    handleBody("payload", [&](RequestHTTP& request){
+        ++handled;
+        std::string& body = request.body();
+        const std::string_view view = request.bodyView();
+        EXPECT_EQ(view, "payload");
+        //The view refers to the text body, no raw body is created
+        EXPECT_EQ(view.data(), body.data());
+    });
+    handleBody("payload", [&](RequestHTTP& request){
+        ++handled;
+        const std::string_view view = request.bodyView();
+        EXPECT_EQ(view, "payload");
+        //The body is read into the raw buffer which the view refers to
+        EXPECT_EQ(view.data(), request.bodyRaw().begin());
+        EXPECT_EQ(request.bodyView().data(), view.data());
+    });
+    handleBody("", [&](RequestHTTP& request){
+        ++handled;
+        EXPECT_TRUE(request.bodyView().empty());
+        EXPECT_EQ(request.body(), "");
+    });
+    EXPECT_EQ(handled, 3);
+}
@@ -0,0 +1,211 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/RouteTree.h"
+
+using raven::net::PathParam;
+using raven::net::RouteTree;
+
+/**
+ * Finds the specified path and returns the captured parameters
+ * as 'name=value' strings.
+ */
+static std::size_t find(
+    const RouteTree& tree,
+    const std::string& path,
+    std::vector<std::string>& captured){
+
+    std::vector<PathParam> params;
+    const std::size_t route = tree.find(path, params);
+    captured.clear();
+    for(const PathParam& param : params){
+        captured.push_back(
+            std::string(param.name) + "=" + std::string(param.value));
+    }
+    return route;
+}
+
+TEST(RouteTreeTest, TestStaticRoutes){
+    RouteTree tree;
+    tree.insert("/users", 0);
+    tree.insert("/users/all", 1);
+    //Splits the edge of the routes above
+    tree.insert("/user", 2);
+    tree.insert("/", 3);
+    tree.insert("/uploads", 4);
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/users", params), 0u);
+    EXPECT_EQ(find(tree, "/users/all", params), 1u);
+    EXPECT_EQ(find(tree, "/user", params), 2u);
+    EXPECT_EQ(find(tree, "/", params), 3u);
+    EXPECT_EQ(find(tree, "/uploads", params), 4u);
+    EXPECT_TRUE(params.empty());
+    EXPECT_EQ(find(tree, "/us", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "/users/", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "/users/al", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "/usersx", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "", params), RouteTree::NO_ROUTE);
+}
+
+TEST(RouteTreeTest, TestParameters){
+    RouteTree tree;
+    tree.insert("/users/{id}", 0);
+    tree.insert("/users/{id}/orders/{order}", 1);
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/users/42", params), 0u);
+    EXPECT_EQ(params, std::vector<std::string>{"id=42"});
+    EXPECT_EQ(find(tree, "/users/42/orders/7", params), 1u);
+    EXPECT_EQ(params, (std::vector<std::string>{"id=42", "order=7"}));
+    //Parameters match exactly one non-empty segment
+    EXPECT_EQ(find(tree, "/users/", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "/users/42/", params), RouteTree::NO_ROUTE);
+    EXPECT_EQ(find(tree, "/users/42/orders", params), RouteTree::NO_ROUTE);
+    EXPECT_TRUE(params.empty());
+}
+
+TEST(RouteTreeTest, TestWildcards){
+    RouteTree tree;
+    tree.insert("/files/*path", 0);
+    tree.insert("/static/*", 1);
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/files/a/b/c.txt", params), 0u);
+    EXPECT_EQ(params, std::vector<std::string>{"path=a/b/c.txt"});
+    EXPECT_EQ(find(tree, "/files/", params), 0u);
+    EXPECT_EQ(params, std::vector<std::string>{"path="});
+    EXPECT_EQ(find(tree, "/static/app.js", params), 1u);
+    EXPECT_EQ(params, std::vector<std::string>{"*=app.js"});
+    EXPECT_EQ(find(tree, "/files", params), RouteTree::NO_ROUTE);
+}
+
+TEST(RouteTreeTest, TestPriority){
+    RouteTree tree;
+    tree.insert("/files/*path", 0);
+    tree.insert("/files/{name}", 1);
+    tree.insert("/files/readme", 2);
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/files/readme", params), 2u);
+    EXPECT_TRUE(params.empty());
+    EXPECT_EQ(find(tree, "/files/other", params), 1u);
+    EXPECT_EQ(params, std::vector<std::string>{"name=other"});
+    EXPECT_EQ(find(tree, "/files/readme/more", params), 0u);
+    EXPECT_EQ(params, std::vector<std::string>{"path=readme/more"});
+}
+
+TEST(RouteTreeTest, TestBacktracking){
+    RouteTree tree;
+    tree.insert("/a/b/c", 0);
+    tree.insert("/a/{x}/d", 1);
+    tree.insert("/a/{x}/{y}/e", 2);
+    tree.insert("/a/*rest", 3);
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/a/b/c", params), 0u);
+    EXPECT_TRUE(params.empty());
+    //The static branch fails after '/a/b/', the parameter matches
+    EXPECT_EQ(find(tree, "/a/b/d", params), 1u);
+    EXPECT_EQ(params, std::vector<std::string>{"x=b"});
+    EXPECT_EQ(find(tree, "/a/b/c/e", params), 2u);
+    EXPECT_EQ(params, (std::vector<std::string>{"x=b", "y=c"}));
+    //Parameters of the failed partial matches are removed
+    EXPECT_EQ(find(tree, "/a/b/c/f", params), 3u);
+    EXPECT_EQ(params, std::vector<std::string>{"rest=b/c/f"});
+}
+
+TEST(RouteTreeTest, TestConflicts){
+    RouteTree tree;
+    tree.insert("/a", 0);
+    tree.insert("/a/{x}", 1);
+    tree.insert("/a/*rest", 2);
+    EXPECT_THROW(tree.insert("/a", 3), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{x}", 3), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{y}", 3), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{y}/b", 3), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/*other", 3), std::runtime_error);
+    EXPECT_THROW(tree.insert("/b", RouteTree::NO_ROUTE), std::runtime_error);
+    //The same parameter name may be extended
+    EXPECT_NO_THROW(tree.insert("/a/{x}/b", 3));
+
+    std::vector<std::string> params;
+    EXPECT_EQ(find(tree, "/a/1/b", params), 3u);
+    EXPECT_EQ(params, std::vector<std::string>{"x=1"});
+}
+
+TEST(RouteTreeTest, TestMalformedPatterns){
+    RouteTree tree;
+    EXPECT_THROW(tree.insert("/a{x}", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{}", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{x", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/{x}b", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/b*", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/*x/b", 0), std::runtime_error);
+    EXPECT_THROW(tree.insert("/a/*{x}", 0), std::runtime_error);
+}
+
+/**
+ * Compares the lookup time of the RouteTree with a std::map holding the
+ * same literal paths, which is how routes were looked up before. Run
+ * with --gtest_also_run_disabled_tests.
+ */
+TEST(RouteTreeTest, DISABLED_BenchmarkFindAgainstMap){
+    const int count = 200;
+    const int lookups = 2000000;
+    RouteTree tree;
+    std::map<std::string, std::size_t> map;
+    std::vector<std::string> paths;
+    for(int i = 0; i < count; ++i){
+        const std::string path =
+            "/api/v1/resource" + std::to_string(i) + "/items";
+
+        tree.insert(path, i);
+        map[path] = i;
+        paths.push_back(path);
+    }
+    tree.insert("/api/v1/users/{id}/items", count);
+
+    std::vector<PathParam> params;
+    std::size_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < lookups; ++i){
+        params.clear();
+        sum += tree.find(paths[i % count], params);
+    }
+    const auto treeTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < lookups; ++i){
+        sum += map.find(paths[i % count])->second;
+    }
+    const auto mapTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < lookups; ++i){
+        params.clear();
+        sum += tree.find("/api/v1/users/42/items", params);
+    }
+    const auto paramTime = std::chrono::steady_clock::now() - start;
+
+    auto nanos = [&](std::chrono::steady_clock::duration time){
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time)
+            .count() / lookups;
+    };
+    std::cout << "[ BENCHMARK] RouteTree::find() literal: "
+              << nanos(treeTime) << " ns, parameter: "
+              << nanos(paramTime) << " ns, std::map::find(): "
+              << nanos(mapTime) << " ns (" << sum << ")" << std::endl;
+}
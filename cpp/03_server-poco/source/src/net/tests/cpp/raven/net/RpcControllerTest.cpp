@@ -0,0 +1,294 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <stdexcept>
+
+#include "Poco/Dynamic/Var.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Parser.h"
+
+#include "raven/net/RpcController.h"
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/util/WorkerPool.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::RpcController;
+using raven::net::RpcException;
+using raven::net::Session;
+using raven::net::Message;
+using raven::util::WorkerPool;
+using Poco::Dynamic::Var;
+using Poco::JSON::Object;
+using Poco::JSON::Parser;
+
+static Object::Ptr parseJSON(const std::string& text){
+    Parser parser;
+    return parser.parse(text).extract<Object::Ptr>();
+}
+
+static void receive(
+    RpcController& controller,
+    Session& session,
+    const std::string& text){
+
+    Message message(1, text);
+    controller.onMessageReceived(session, message);
+}
+
+static int errorCode(const std::string& response){
+    return parseJSON(response)->getObject("error")->getValue<int>("code");
+}
+
+TEST(RpcControllerTest, TestCallResponseCorrelation){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    RpcController controller(1);
+
+    auto first = controller.call(
+        *session, "first", Var(), std::chrono::seconds(10));
+    auto second = controller.call(
+        *session, "second", Var(), std::chrono::seconds(10));
+
+    std::vector<std::string> sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 2u);
+    Object::Ptr req1 = parseJSON(sent[0]);
+    Object::Ptr req2 = parseJSON(sent[1]);
+    EXPECT_EQ(req1->getValue<std::string>("method"), "first");
+    EXPECT_EQ(req2->getValue<std::string>("method"), "second");
+    const std::string id1 = req1->get("id").toString();
+    const std::string id2 = req2->get("id").toString();
+    EXPECT_NE(id1, id2);
+
+    //Answer in reverse order
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":" + id2 + ",\"result\":\"two\"}");
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":" + id1 + ","
+        "\"error\":{\"code\":42,\"message\":\"refused\"}}");
+
+    EXPECT_EQ(second.get().convert<std::string>(), "two");
+    try{
+        first.get();
+        FAIL() << "Expected RpcException";
+    }catch(const RpcException& ex){
+        EXPECT_EQ(ex.getCode(), 42);
+        EXPECT_STREQ(ex.what(), "refused");
+    }
+    //Responses to unknown calls are ignored
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":" + id1 + ",\"result\":1}");
+    EXPECT_EQ(provider->getSent().size(), 2u);
+}
+
+TEST(RpcControllerTest, TestMalformedErrorResponse){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    RpcController controller(1);
+
+    auto notObject = controller.call(
+        *session, "a", Var(), std::chrono::seconds(10));
+    auto noMessage = controller.call(
+        *session, "b", Var(), std::chrono::seconds(10));
+
+    std::vector<std::string> sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 2u);
+    const std::string id1 = parseJSON(sent[0])->get("id").toString();
+    const std::string id2 = parseJSON(sent[1])->get("id").toString();
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":" + id1 + ",\"error\":\"failed\"}");
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":" + id2 + ",\"error\":{\"code\":1}}");
+    //Responses with a negative ID are ignored
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":-1,\"result\":1}");
+
+    for(auto* result : {&notObject, &noMessage}){
+        ASSERT_EQ(
+            result->wait_for(std::chrono::milliseconds(0)),
+            std::future_status::ready);
+        try{
+            result->get();
+            FAIL() << "Expected RpcException";
+        }catch(const RpcException& ex){
+            EXPECT_EQ(ex.getCode(), RpcException::INTERNAL_ERROR);
+        }
+    }
+    //Responses are never answered
+    EXPECT_EQ(provider->getSent().size(), 2u);
+}
+
+TEST(RpcControllerTest, TestInFlightLimit){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    RpcController controller(2, 1);
+    controller.registerMethod("wait", [opened](Session& s, const Var& params){
+        opened.wait();
+        return Var(1);
+    });
+
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"wait\"}");
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"wait\"}");
+    //Notifications exceeding the limit are dropped without a response
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"method\":\"wait\"}");
+
+    std::vector<std::string> sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 1u);
+    EXPECT_EQ(parseJSON(sent[0])->getValue<int>("id"), 2);
+    EXPECT_EQ(errorCode(sent[0]), RpcException::SERVER_BUSY);
+
+    //The limit applies per Session
+    auto other = std::make_shared<TestSessionProvider>();
+    auto otherSession = std::make_shared<Session>(other);
+    receive(controller, *otherSession,
+        "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"wait\"}");
+
+    gate.set_value();
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while(provider->getSent().size() < 2
+        && std::chrono::steady_clock::now() < deadline){
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(provider->getSent().size(), 2u);
+    //The slot is released when the call has completed
+    receive(controller, *session,
+        "{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"wait\"}");
+    while(provider->getSent().size() < 3
+        && std::chrono::steady_clock::now() < deadline){
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 3u);
+    EXPECT_EQ(parseJSON(sent[1])->getValue<int>("result"), 1);
+    EXPECT_EQ(parseJSON(sent[2])->getValue<int>("id"), 3);
+    EXPECT_EQ(parseJSON(sent[2])->getValue<int>("result"), 1);
+}
+
+TEST(RpcControllerTest, TestCallDeadlineAndDisconnect){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    RpcController controller(1);
+
+    auto expiring = controller.call(
+        *session, "slow", Var(), std::chrono::milliseconds(20));
+    auto pending = controller.call(
+        *session, "slow", Var(), std::chrono::seconds(10));
+
+    ASSERT_EQ(
+        expiring.wait_for(std::chrono::seconds(5)),
+        std::future_status::ready);
+    try{
+        expiring.get();
+        FAIL() << "Expected RpcException";
+    }catch(const RpcException& ex){
+        EXPECT_EQ(ex.getCode(), RpcException::TIMEOUT);
+    }
+    EXPECT_EQ(
+        pending.wait_for(std::chrono::milliseconds(0)),
+        std::future_status::timeout);
+
+    controller.onDisconnect(*session);
+    try{
+        pending.get();
+        FAIL() << "Expected RpcException";
+    }catch(const RpcException& ex){
+        EXPECT_EQ(ex.getCode(), RpcException::SESSION_CLOSED);
+    }
+}
+
+TEST(RpcControllerTest, TestClientRequests){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    {
+        RpcController controller(1);
+        controller.registerMethod("add", [](Session& s, const Var& params){
+            return Var(params.convert<int>() + 1);
+        });
+        controller.registerMethod("refuse", [](Session& s, const Var& params){
+            throw RpcException(7, "refused");
+            return Var();
+        });
+        controller.registerMethod("crash", [](Session& s, const Var& params){
+            throw std::runtime_error("crash");
+            return Var();
+        });
+        receive(controller, *session,
+            "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"add\",\"params\":41}");
+        receive(controller, *session,
+            "{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"refuse\"}");
+        receive(controller, *session,
+            "{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"crash\"}");
+        receive(controller, *session,
+            "{\"jsonrpc\":\"2.0\",\"id\":4,\"method\":\"unknown\"}");
+        //Notifications are never answered
+        receive(controller, *session,
+            "{\"jsonrpc\":\"2.0\",\"method\":\"add\",\"params\":1}");
+        //Destroying the controller drains the worker pool
+    }
+    std::vector<std::string> sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 4u);
+    Object::Ptr result = parseJSON(sent[0]);
+    EXPECT_EQ(result->getValue<int>("id"), 1);
+    EXPECT_EQ(result->getValue<int>("result"), 42);
+    EXPECT_EQ(parseJSON(sent[1])->getValue<int>("id"), 2);
+    EXPECT_EQ(errorCode(sent[1]), 7);
+    EXPECT_EQ(errorCode(sent[2]), RpcException::INTERNAL_ERROR);
+    EXPECT_EQ(errorCode(sent[3]), RpcException::METHOD_NOT_FOUND);
+}
+
+TEST(RpcControllerTest, TestInvalidMessages){
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+    RpcController controller(1);
+
+    receive(controller, *session, "{\"jsonrpc\":");
+    receive(controller, *session, "[{\"jsonrpc\":\"2.0\",\"method\":\"a\"}]");
+    receive(controller, *session, "42");
+    receive(controller, *session, "{\"jsonrpc\":\"2.0\",\"id\":\"x\"}");
+
+    std::vector<std::string> sent = provider->getSent();
+    ASSERT_EQ(sent.size(), 4u);
+    EXPECT_EQ(errorCode(sent[0]), RpcException::PARSE_ERROR);
+    EXPECT_EQ(errorCode(sent[1]), RpcException::INVALID_REQUEST);
+    EXPECT_EQ(errorCode(sent[2]), RpcException::INVALID_REQUEST);
+    EXPECT_EQ(errorCode(sent[3]), RpcException::INVALID_REQUEST);
+    EXPECT_TRUE(parseJSON(sent[1])->get("id").isEmpty());
+}
+
+TEST(RpcControllerTest, TestWorkerPoolShutdown){
+    std::atomic<int> done(0);
+    WorkerPool pool(2);
+    for(int i = 0; i < 16; ++i){
+        pool.submit([&done]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++done;
+        });
+    }
+    //Stopping waits for all queued tasks
+    pool.stop();
+    EXPECT_EQ(done.load(), 16);
+
+    //Tasks submitted after stopping are discarded
+    pool.submit([&done]{ ++done; });
+    pool.stop();
+    EXPECT_EQ(done.load(), 16);
+}
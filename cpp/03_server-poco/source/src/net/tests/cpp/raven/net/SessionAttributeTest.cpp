@@ -0,0 +1,117 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <set>
+#include <thread>
+#include <atomic>
+
+#include "raven/net/Session.h"
+#include "raven/net/SessionAttribute.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::SessionAttribute;
+using raven::net::SESSION_MAX_ATTRIBUTES;
+
+/**
+ * Attribute value which counts its constructions and destructions.
+ */
+struct TrackedValue {
+
+    static std::atomic<int> constructed;
+    static std::atomic<int> destroyed;
+
+    int value = 0;
+
+    TrackedValue(){
+        ++constructed;
+    }
+
+    ~TrackedValue(){
+        ++destroyed;
+    }
+};
+
+std::atomic<int> TrackedValue::constructed(0);
+std::atomic<int> TrackedValue::destroyed(0);
+
+//Attributes are registered once per process, like in applications
+static const SessionAttribute<std::string> NAME;
+static const SessionAttribute<TrackedValue> TRACKED;
+
+static std::shared_ptr<Session> newSession(){
+    return std::make_shared<Session>(std::make_shared<TestSessionProvider>());
+}
+
+TEST(SessionAttributeTest, TestSlots){
+    EXPECT_NE(NAME.getSlot(), TRACKED.getSlot());
+    EXPECT_LT(NAME.getSlot(), SESSION_MAX_ATTRIBUTES);
+    EXPECT_LT(TRACKED.getSlot(), SESSION_MAX_ATTRIBUTES);
+}
+
+TEST(SessionAttributeTest, TestGetAndHasAttribute){
+    auto session = newSession();
+    auto other = newSession();
+    EXPECT_FALSE(session->hasAttribute(NAME));
+    EXPECT_EQ(session->getAttribute(NAME), "");
+    EXPECT_TRUE(session->hasAttribute(NAME));
+
+    session->getAttribute(NAME) = "first";
+    EXPECT_EQ(session->getAttribute(NAME), "first");
+    EXPECT_EQ(&session->getAttribute(NAME), &session->getAttribute(NAME));
+    //Values are stored per session
+    EXPECT_FALSE(other->hasAttribute(NAME));
+    EXPECT_EQ(other->getAttribute(NAME), "");
+    EXPECT_FALSE(session->hasAttribute(TRACKED));
+}
+
+TEST(SessionAttributeTest, TestValuesAreDestroyedWithSession){
+    const int constructed = TrackedValue::constructed;
+    const int destroyed = TrackedValue::destroyed;
+    auto session = newSession();
+    auto unused = newSession();
+    session->getAttribute(TRACKED).value = 42;
+    EXPECT_EQ(TrackedValue::constructed, constructed + 1);
+
+    unused.reset();
+    EXPECT_EQ(TrackedValue::destroyed, destroyed);
+    session.reset();
+    EXPECT_EQ(TrackedValue::destroyed, destroyed + 1);
+}
+
+TEST(SessionAttributeTest, TestConcurrentInitialization){
+    const int constructed = TrackedValue::constructed;
+    const int destroyed = TrackedValue::destroyed;
+    auto session = newSession();
+    const int count = 8;
+    std::atomic<int> ready(0);
+    std::vector<TrackedValue*> values(count, nullptr);
+    std::vector<std::thread> threads;
+    for(int i = 0; i < count; ++i){
+        threads.emplace_back([&, i]{
+            ++ready;
+            while(ready < count){
+                std::this_thread::yield();
+            }
+            values[i] = &session->getAttribute(TRACKED);
+        });
+    }
+    for(std::thread& thread : threads){
+        thread.join();
+    }
+    //All threads see the value which won the race
+    EXPECT_EQ(std::set<TrackedValue*>(values.begin(), values.end()).size(), 1u);
+    //Values which lost the race were destroyed right away
+    const int created = TrackedValue::constructed - constructed;
+    EXPECT_GE(created, 1);
+    EXPECT_EQ(TrackedValue::destroyed - destroyed, created - 1);
+
+    session.reset();
+    EXPECT_EQ(TrackedValue::destroyed - destroyed, created);
+}
@@ -0,0 +1,95 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/net/SessionHandler.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::MessagePriority;
+using raven::net::SessionHandler;
+
+TEST(SessionGroupsTest, TestJoinSendLeave){
+    SessionHandler& handler = SessionHandler::getInstance();
+    auto p1 = std::make_shared<TestSessionProvider>();
+    auto p2 = std::make_shared<TestSessionProvider>();
+    auto s1 = std::make_shared<Session>(p1);
+    auto s2 = std::make_shared<Session>(p2);
+
+    EXPECT_TRUE(handler.joinGroup(s1, "test.groups.a"));
+    EXPECT_TRUE(handler.joinGroup(s2, "test.groups.a"));
+    EXPECT_TRUE(handler.joinGroup(s1, "test.groups.b"));
+    EXPECT_FALSE(handler.joinGroup(s1, "test.groups.a"));
+    EXPECT_FALSE(handler.joinGroup(nullptr, "test.groups.a"));
+    EXPECT_EQ(handler.getGroupSize("test.groups.a"), 2u);
+    EXPECT_EQ(handler.getGroupSize("test.groups.b"), 1u);
+
+    EXPECT_EQ(handler.sendToGroup(
+        "test.groups.a", "hello", MessagePriority::INTERACTIVE), 2u);
+
+    EXPECT_EQ(p1->getSent(), std::vector<std::string>{"hello"});
+    EXPECT_EQ(p2->getSent(), std::vector<std::string>{"hello"});
+    //All members share a single message
+    ASSERT_NE(p1->lastMessage, nullptr);
+    EXPECT_EQ(p1->lastMessage, p2->lastMessage);
+
+    EXPECT_TRUE(handler.leaveGroup(*s2, "test.groups.a"));
+    EXPECT_FALSE(handler.leaveGroup(*s2, "test.groups.a"));
+    EXPECT_EQ(handler.sendToGroup(
+        "test.groups.a", "again", MessagePriority::INTERACTIVE), 1u);
+
+    EXPECT_EQ(p2->getSent().size(), 1u);
+
+    handler.leaveAllGroups(*s1);
+    EXPECT_EQ(handler.getGroupSize("test.groups.a"), 0u);
+    EXPECT_EQ(handler.getGroupSize("test.groups.b"), 0u);
+    EXPECT_EQ(handler.sendToGroup(
+        "test.groups.a", "none", MessagePriority::INTERACTIVE), 0u);
+}
+
+TEST(SessionGroupsTest, TestClosedSessionCannotJoin){
+    SessionHandler& handler = SessionHandler::getInstance();
+    auto provider = std::make_shared<TestSessionProvider>();
+    auto session = std::make_shared<Session>(provider);
+
+    EXPECT_TRUE(handler.joinGroup(session, "test.groups.closed"));
+    //Sessions are closed before they leave all groups on disconnect
+    session->close();
+    handler.leaveAllGroups(*session);
+    EXPECT_FALSE(handler.joinGroup(session, "test.groups.closed"));
+    EXPECT_EQ(handler.getGroupSize("test.groups.closed"), 0u);
+}
+
+TEST(SessionGroupsTest, TestMemberMayLeaveWhileSending){
+    SessionHandler& handler = SessionHandler::getInstance();
+    auto p1 = std::make_shared<TestSessionProvider>();
+    auto p2 = std::make_shared<TestSessionProvider>();
+    auto s1 = std::make_shared<Session>(p1);
+    auto s2 = std::make_shared<Session>(p2);
+    //E.g. a slow consumer which is evicted while a message is sent
+    p1->onSend = [&](const std::string&){
+        handler.leaveGroup(*s1, "test.groups.leave");
+        handler.joinGroup(s1, "test.groups.other");
+    };
+    handler.joinGroup(s1, "test.groups.leave");
+    handler.joinGroup(s2, "test.groups.leave");
+
+    EXPECT_EQ(handler.sendToGroup(
+        "test.groups.leave", "hello", MessagePriority::INTERACTIVE), 2u);
+
+    EXPECT_EQ(p1->getSent().size(), 1u);
+    EXPECT_EQ(p2->getSent().size(), 1u);
+    EXPECT_EQ(handler.getGroupSize("test.groups.leave"), 1u);
+    EXPECT_EQ(handler.getGroupSize("test.groups.other"), 1u);
+    p1->onSend = nullptr;
+    handler.leaveAllGroups(*s1);
+    handler.leaveAllGroups(*s2);
+}
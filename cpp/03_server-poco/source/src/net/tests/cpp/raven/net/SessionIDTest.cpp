@@ -0,0 +1,76 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <string>
+#include <set>
+#include <algorithm>
+#include <cctype>
+
+#include "raven/net/SessionID.h"
+
+using raven::net::SessionID;
+using raven::net::SessionKey;
+
+TEST(SessionIDTest, TestGenerateRoundTrip){
+    std::set<std::string> seen;
+    for(int i = 0; i < 1000; ++i){
+        const SessionID id = SessionID::generate();
+        const std::string& text = id.toString();
+        ASSERT_EQ(text.size(), 36u);
+        //Version 4, variant 1 UUID
+        EXPECT_EQ(text[14], '4');
+        EXPECT_NE(std::string("89ab").find(text[19]), std::string::npos);
+        EXPECT_TRUE(seen.insert(text).second);
+
+        SessionKey key{0, 0};
+        ASSERT_TRUE(SessionID::parse(text, key));
+        EXPECT_TRUE(key == id.getKey());
+        EXPECT_EQ(SessionID(key).toString(), text);
+    }
+}
+
+TEST(SessionIDTest, TestStringForm){
+    const SessionKey key{0x0123456789abcdefULL, 0xfedcba9876543210ULL};
+    const SessionID id(key);
+    EXPECT_EQ(id.toString(), "01234567-89ab-cdef-fedc-ba9876543210");
+    EXPECT_TRUE(id.getKey() == key);
+}
+
+TEST(SessionIDTest, TestParseUpperCase){
+    const SessionID id = SessionID::generate();
+    std::string upper = id.toString();
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    SessionKey key{0, 0};
+    ASSERT_TRUE(SessionID::parse(upper, key));
+    EXPECT_TRUE(key == id.getKey());
+    //The string form is always lower case
+    EXPECT_EQ(SessionID(key).toString(), id.toString());
+}
+
+TEST(SessionIDTest, TestParseRejectsInvalid){
+    const std::string valid = "01234567-89ab-cdef-fedc-ba9876543210";
+    const SessionKey untouched{1, 2};
+    SessionKey key = untouched;
+    ASSERT_TRUE(SessionID::parse(valid, key));
+
+    const std::string invalid[] = {
+        "",
+        valid.substr(0, 35),
+        valid + "0",
+        "0123456789ab-cdef-fedc-ba9876543210",
+        "01234567-89abc-def-fedc-ba9876543210",
+        "0123456-789ab-cdef-fedc-ba9876543210",
+        "01234567-89ab-cdef-fedcb-a9876543210",
+        "01234567089ab-cdef-fedc-ba9876543210",
+        "01234567-89ab-cdef-fedc-ba987654321g",
+        "01234567-89ab-cdef-fedc-ba98765432 0",
+        "{1234567-89ab-cdef-fedc-ba987654321}"
+    };
+    for(const std::string& text : invalid){
+        key = untouched;
+        EXPECT_FALSE(SessionID::parse(text, key)) << text;
+        EXPECT_TRUE(key == untouched) << text;
+    }
+}
@@ -0,0 +1,145 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+#include "raven/net/Session.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/SessionRegistry.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::SessionID;
+using raven::net::SessionKey;
+using raven::net::SessionRegistry;
+
+static std::shared_ptr<Session> newSession(){
+    return std::make_shared<Session>(std::make_shared<TestSessionProvider>());
+}
+
+TEST(SessionRegistryTest, TestInsertFindErase){
+    SessionRegistry registry;
+    const SessionKey key = SessionID::generate().getKey();
+    const SessionKey other = SessionID::generate().getKey();
+    auto session = newSession();
+    auto replacement = newSession();
+
+    EXPECT_EQ(registry.find(key), nullptr);
+    EXPECT_EQ(registry.size(), 0u);
+    registry.insert(key, session);
+    EXPECT_EQ(registry.find(key), session);
+    EXPECT_EQ(registry.find(other), nullptr);
+    EXPECT_EQ(registry.size(), 1u);
+
+    registry.insert(key, replacement);
+    EXPECT_EQ(registry.find(key), replacement);
+    EXPECT_EQ(registry.size(), 1u);
+
+    EXPECT_FALSE(registry.erase(other));
+    EXPECT_TRUE(registry.erase(key));
+    EXPECT_FALSE(registry.erase(key));
+    EXPECT_EQ(registry.find(key), nullptr);
+    EXPECT_EQ(registry.size(), 0u);
+}
+
+TEST(SessionRegistryTest, TestGetAll){
+    SessionRegistry registry;
+    std::set<std::shared_ptr<Session>> expected;
+    std::vector<SessionKey> keys;
+    //Enough sessions to cover all shards
+    for(int i = 0; i < 512; ++i){
+        auto session = newSession();
+        const SessionKey key = SessionID::generate().getKey();
+        registry.insert(key, session);
+        expected.insert(session);
+        keys.push_back(key);
+    }
+    EXPECT_EQ(registry.size(), 512u);
+    const std::vector<std::shared_ptr<Session>> all = registry.getAll();
+    EXPECT_EQ(std::set<std::shared_ptr<Session>>(all.begin(), all.end()), expected);
+
+    for(const SessionKey& key : keys){
+        EXPECT_TRUE(registry.erase(key));
+    }
+    EXPECT_TRUE(registry.getAll().empty());
+}
+
+TEST(SessionRegistryTest, TestConcurrentAccess){
+    SessionRegistry registry;
+    std::atomic<int> missing(0);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 8; ++t){
+        threads.emplace_back([&]{
+            for(int i = 0; i < 500; ++i){
+                const SessionKey key = SessionID::generate().getKey();
+                auto session = newSession();
+                registry.insert(key, session);
+                if(registry.find(key) != session){
+                    ++missing;
+                }
+                registry.getAll();
+                if(!registry.erase(key)){
+                    ++missing;
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads){
+        thread.join();
+    }
+    EXPECT_EQ(missing, 0);
+    EXPECT_EQ(registry.size(), 0u);
+}
+
+/**
+ * Measures the throughput of concurrent lookups for an increasing number
+ * of threads. Run with --gtest_also_run_disabled_tests. With sharded
+ * locks, the throughput should grow with the number of cores.
+ */
+TEST(SessionRegistryTest, DISABLED_BenchmarkConcurrentFind){
+    SessionRegistry registry;
+    std::vector<SessionKey> keys;
+    for(int i = 0; i < 10000; ++i){
+        keys.push_back(SessionID::generate().getKey());
+        registry.insert(keys.back(), newSession());
+    }
+    const unsigned int cores =
+        std::max(1u, std::thread::hardware_concurrency());
+
+    for(unsigned int count = 1; count <= cores; count *= 2){
+        std::atomic<bool> running(true);
+        std::atomic<std::uint64_t> total(0);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < count; ++t){
+            threads.emplace_back([&, t]{
+                std::uint64_t lookups = 0;
+                std::size_t i = t * 7919;
+                while(running.load(std::memory_order_relaxed)){
+                    registry.find(keys[i++ % keys.size()]);
+                    ++lookups;
+                }
+                total += lookups;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        running = false;
+        for(std::thread& thread : threads){
+            thread.join();
+        }
+        std::cout << "[ BENCHMARK] SessionRegistry::find() with "
+                  << count << " thread(s): "
+                  << (total * 2) << " lookups/s" << std::endl;
+    }
+}
@@ -0,0 +1,205 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/SessionHandler.h"
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/TypedWebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/WebSocketHandler.h"
+#include "raven/net/WebSocketOptions.h"
+#include "raven/net/WebSocketWriter.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::Message;
+using raven::net::MessagePriority;
+using raven::net::SendStatus;
+using raven::net::SessionID;
+using raven::net::SessionHandler;
+using raven::net::SessionReplayBuffer;
+using raven::net::TypedWebSocketController;
+using raven::net::WebSocketControllerBinding;
+using raven::net::WebSocketHandler;
+using raven::net::WebSocketOptions;
+using raven::net::WebSocketWriter;
+using raven::net::WSWQ_Item;
+
+class ReplayController : public TypedWebSocketController<ReplayController> { };
+
+/**
+ * A writer whose thread is never started. Queued messages
+ * are written by the test through the write() method.
+ */
+class ReplayWriter {
+
+    ReplayController _controller;
+
+public:
+
+    WebSocketWriter writer;
+
+    ReplayWriter()
+        : writer(std::make_shared<WebSocketHandler>(
+              WebSocketControllerBinding::of(_controller),
+              WebSocketOptions())){ }
+
+    /**
+     * Takes the specified number of messages from the queue of the writer
+     * in the order the writer thread would write them, marks them as
+     * written and returns their texts.
+     */
+    std::vector<std::string> write(
+        SessionReplayBuffer& replay,
+        std::size_t count){
+
+        std::vector<std::string> texts;
+        for(std::size_t i = 0; i < count; ++i){
+            WSWQ_Item item = writer.getQueue().get();
+            replay.written(item.msg, item.priority);
+            texts.push_back(item.msg->getText());
+        }
+        return texts;
+    }
+};
+
+static void send(
+    SessionReplayBuffer& replay,
+    const std::string& text,
+    MessagePriority priority = MessagePriority::INTERACTIVE){
+
+    replay.send(std::make_shared<Message>(text), priority, nullptr);
+}
+
+TEST(SessionReplayBufferTest, TestSequenceFollowsWriteOrder){
+    SessionReplayBuffer replay(SessionID::generate(), "token", "/ws", 8);
+    ReplayWriter first;
+    replay.attach(first.writer);
+    send(replay, "b1", MessagePriority::BULK);
+    send(replay, "i1");
+    send(replay, "i2");
+    //Interactive messages overtake the bulk message
+    EXPECT_EQ(first.write(replay, 3),
+              (std::vector<std::string>{"i1", "i2", "b1"}));
+
+    replay.detach(first.writer);
+    //The client has received i1 and i2 only
+    ASSERT_TRUE(replay.claim(2));
+    ReplayWriter second;
+    replay.attach(second.writer);
+    EXPECT_EQ(second.write(replay, 1), std::vector<std::string>{"b1"});
+    EXPECT_EQ(second.writer.getQueueDepth(), 0u);
+    replay.detach(second.writer);
+}
+
+TEST(SessionReplayBufferTest, TestClaimBounds){
+    SessionReplayBuffer replay(SessionID::generate(), "token", "/ws", 2);
+    ReplayWriter first;
+    replay.attach(first.writer);
+    send(replay, "m1");
+    send(replay, "m2");
+    send(replay, "m3");
+    first.write(replay, 3);
+    replay.detach(first.writer);
+
+    //Sequence number 4 has not been assigned yet
+    EXPECT_FALSE(replay.claim(4));
+    //Message 1 has been evicted from the buffer
+    EXPECT_FALSE(replay.claim(0));
+    EXPECT_TRUE(replay.claim(3));
+    EXPECT_TRUE(replay.claim(1));
+    //Messages 2 and 3 are written again and numbered anew
+    EXPECT_FALSE(replay.claim(2));
+}
+
+TEST(SessionReplayBufferTest, TestAttachReplaysMissedMessages){
+    SessionReplayBuffer replay(SessionID::generate(), "token", "/ws", 8);
+    ReplayWriter first;
+    replay.attach(first.writer);
+    send(replay, "m1");
+    send(replay, "m2");
+    first.write(replay, 2);
+    send(replay, "m3");
+    replay.detach(first.writer);
+
+    std::vector<SendStatus> statuses;
+    replay.send(
+        std::make_shared<Message>("m4"),
+        MessagePriority::BULK,
+        [&](SendStatus status, std::size_t depth){
+            statuses.push_back(status);
+        });
+
+    EXPECT_EQ(statuses, std::vector<SendStatus>{SendStatus::BUFFERED});
+    ASSERT_TRUE(replay.claim(1));
+    ReplayWriter second;
+    replay.attach(second.writer);
+    send(replay, "m5");
+    //Written and unwritten missed messages are sent before new ones
+    EXPECT_EQ(second.write(replay, 4),
+              (std::vector<std::string>{"m2", "m3", "m5", "m4"}));
+
+    replay.detach(second.writer);
+    //Numbering continues after the claimed sequence number
+    EXPECT_FALSE(replay.claim(6));
+    EXPECT_TRUE(replay.claim(5));
+}
+
+TEST(SessionReplayBufferTest, TestOverflowWhileDetached){
+    SessionReplayBuffer replay(SessionID::generate(), "token", "/ws", 2);
+    send(replay, "m1");
+    send(replay, "m2");
+    EXPECT_TRUE(replay.claim(0));
+    send(replay, "m3");
+    //Message 1 was discarded before it could be written
+    EXPECT_FALSE(replay.claim(0));
+}
+
+TEST(SessionReplayBufferTest, TestResumeOnSameRoute){
+    SessionHandler& handler = SessionHandler::getInstance();
+    auto replay = std::make_shared<SessionReplayBuffer>(
+        SessionID::generate(), "test.replay.route", "/ws/a", 8);
+
+    auto provider = std::make_shared<TestSessionProvider>(replay);
+    auto session = std::make_shared<Session>(provider);
+    handler.suspendSession(session, std::chrono::seconds(30));
+    provider->send("missed", MessagePriority::INTERACTIVE);
+    EXPECT_TRUE(provider->getSent().empty());
+
+    EXPECT_EQ(handler.resumeSession("/ws/b", "test.replay.route", 0), nullptr);
+    EXPECT_EQ(handler.resumeSession("/ws/a", "test.replay.other", 0), nullptr);
+    EXPECT_EQ(handler.resumeSession("/ws/a", "test.replay.route", 0), replay);
+    //A suspended session can only be resumed once
+    EXPECT_EQ(handler.resumeSession("/ws/a", "test.replay.route", 0), nullptr);
+
+    ReplayWriter writer;
+    replay->attach(writer.writer);
+    EXPECT_EQ(writer.write(*replay, 1), std::vector<std::string>{"missed"});
+    replay->detach(writer.writer);
+}
+
+TEST(SessionReplayBufferTest, TestGracePeriodExpires){
+    SessionHandler& handler = SessionHandler::getInstance();
+    auto replay = std::make_shared<SessionReplayBuffer>(
+        SessionID::generate(), "test.replay.expiry", "/ws", 8);
+
+    auto session = std::make_shared<Session>(
+        std::make_shared<TestSessionProvider>(replay));
+
+    handler.suspendSession(session, std::chrono::milliseconds(0));
+    EXPECT_EQ(handler.resumeSession("/ws", "test.replay.expiry", 0), nullptr);
+
+    handler.suspendSession(session, std::chrono::seconds(30));
+    EXPECT_EQ(handler.resumeSession("/ws", "test.replay.expiry", 0), replay);
+}
@@ -0,0 +1,199 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/JSON/Parser.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+
+#include "raven/net/RequestHTTP.h"
+#include "raven/net/ResponseHTTP.h"
+#include "raven/net/Session.h"
+#include "raven/net/SessionStats.h"
+#include "raven/net/SessionStatsReport.h"
+
+#include "TestServerHTTP.h"
+#include "TestSessionProvider.h"
+
+using raven::net::RequestHTTP;
+using raven::net::ResponseHTTP;
+using raven::net::Session;
+using raven::net::SessionStats;
+using raven::net::SessionStatsReport;
+using Poco::JSON::Object;
+using Poco::JSON::Array;
+using Poco::JSON::Parser;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+
+static SessionStats makeStats(
+    const std::string& id,
+    std::uint64_t bytesOut,
+    std::uint64_t bytesIn,
+    std::uint64_t messagesOut,
+    std::uint64_t messagesIn,
+    std::size_t queueDepth,
+    int connectedAt,
+    int lastActivity){
+
+    const std::chrono::system_clock::time_point epoch;
+    SessionStats stats{};
+    stats.id = id;
+    stats.bytesOut = bytesOut;
+    stats.bytesIn = bytesIn;
+    stats.messagesOut = messagesOut;
+    stats.messagesIn = messagesIn;
+    stats.queueDepth = queueDepth;
+    stats.connectedAt = epoch + std::chrono::seconds(connectedAt);
+    stats.lastActivity = epoch + std::chrono::seconds(lastActivity);
+    return stats;
+}
+
+/**
+ * Serves a report of the specified statistics on the route '/stats'.
+ */
+class SessionStatsReportTest : public ::testing::Test {
+protected:
+
+    std::vector<SessionStats> stats;
+
+    /**
+     * Requests the report with the specified query and
+     * returns the parsed response.
+     */
+    Object::Ptr query(const std::string& query, HTTPResponse& response){
+        auto router = std::make_shared<TestRouterHTTP>([this](TestRouterHTTP& r){
+            r.staticRoute(
+                "/stats",
+                [this](RequestHTTP& request, ResponseHTTP& response){
+                    std::vector<SessionStats> copy = stats;
+                    SessionStatsReport::report(request, response, copy);
+                });
+        });
+        TestServerHTTP server(router);
+        const std::string body =
+            server.send(HTTPRequest::HTTP_GET, "/stats" + query, response);
+
+        if(response.getStatus() != HTTPResponse::HTTP_OK){
+            return Object::Ptr();
+        }
+        Parser parser;
+        return parser.parse(body).extract<Object::Ptr>();
+    }
+
+    /**
+     * Returns the IDs of the reported sessions, in report order.
+     */
+    std::vector<std::string> ids(const std::string& query){
+        HTTPResponse response;
+        Object::Ptr result = this->query(query, response);
+        std::vector<std::string> ids;
+        if(result.isNull()){
+            ADD_FAILURE() << "Request failed: " << query;
+            return ids;
+        }
+        Array::Ptr sessions = result->getArray("sessions");
+        for(std::size_t i = 0; i < sessions->size(); ++i){
+            ids.push_back(
+                sessions->getObject(static_cast<unsigned>(i))
+                        ->getValue<std::string>("id"));
+        }
+        return ids;
+    }
+};
+
+TEST_F(SessionStatsReportTest, TestSortFields){
+    stats.push_back(makeStats("a", 1, 3, 2, 3, 1, 2, 1));
+    stats.push_back(makeStats("b", 3, 1, 3, 1, 2, 1, 3));
+    stats.push_back(makeStats("c", 2, 2, 1, 2, 3, 3, 2));
+    using Ids = std::vector<std::string>;
+    EXPECT_EQ(ids(""), (Ids{"b", "c", "a"}));
+    EXPECT_EQ(ids("?sort=bytesOut"), (Ids{"b", "c", "a"}));
+    EXPECT_EQ(ids("?sort=bytesIn"), (Ids{"a", "c", "b"}));
+    EXPECT_EQ(ids("?sort=messagesOut"), (Ids{"b", "a", "c"}));
+    EXPECT_EQ(ids("?sort=messagesIn"), (Ids{"a", "c", "b"}));
+    EXPECT_EQ(ids("?sort=queueDepth"), (Ids{"c", "b", "a"}));
+    //Timestamps are sorted oldest first
+    EXPECT_EQ(ids("?sort=connectedAt"), (Ids{"b", "a", "c"}));
+    EXPECT_EQ(ids("?sort=lastActivity"), (Ids{"a", "c", "b"}));
+}
+
+TEST_F(SessionStatsReportTest, TestPaging){
+    for(int i = 0; i < 10; ++i){
+        stats.push_back(makeStats(std::to_string(i), i, 0, 0, 0, 0, 0, 0));
+    }
+    //Stored in reverse report order, so the page must be sorted
+    using Ids = std::vector<std::string>;
+    EXPECT_EQ(ids("?offset=3&limit=4"), (Ids{"6", "5", "4", "3"}));
+    EXPECT_EQ(ids("?offset=8"), (Ids{"1", "0"}));
+    EXPECT_EQ(ids("?offset=10"), Ids{});
+    EXPECT_EQ(ids("?offset=50&limit=5"), Ids{});
+    EXPECT_EQ(ids("?limit=0"), Ids{});
+
+    HTTPResponse response;
+    Object::Ptr result = query("?offset=3&limit=4", response);
+    ASSERT_FALSE(result.isNull());
+    EXPECT_EQ(result->getValue<int>("total"), 10);
+    EXPECT_EQ(result->getValue<int>("offset"), 3);
+    EXPECT_EQ(result->getValue<int>("limit"), 4);
+    EXPECT_EQ(response.getContentType(), "application/json");
+}
+
+TEST_F(SessionStatsReportTest, TestLimitIsCapped){
+    for(int i = 0; i < 1005; ++i){
+        stats.push_back(makeStats(std::to_string(i), i, 0, 0, 0, 0, 0, 0));
+    }
+    HTTPResponse response;
+    Object::Ptr result = query("?limit=5000", response);
+    ASSERT_FALSE(result.isNull());
+    EXPECT_EQ(result->getValue<int>("limit"), 1000);
+    EXPECT_EQ(result->getArray("sessions")->size(), 1000u);
+    //The default limit applies without a query parameter
+    result = query("", response);
+    ASSERT_FALSE(result.isNull());
+    EXPECT_EQ(result->getValue<int>("limit"), 100);
+    EXPECT_EQ(result->getArray("sessions")->size(), 100u);
+}
+
+TEST_F(SessionStatsReportTest, TestBadRequest){
+    stats.push_back(makeStats("a", 1, 1, 1, 1, 1, 1, 1));
+    for(const std::string q : {
+            "?sort=id", "?sort=name", "?offset=-1", "?offset=x",
+            "?limit=-5", "?limit=ten"}){
+
+        HTTPResponse response;
+        EXPECT_TRUE(query(q, response).isNull()) << q;
+        EXPECT_EQ(response.getStatus(), HTTPResponse::HTTP_BAD_REQUEST) << q;
+    }
+}
+
+TEST(SessionStatsTest, TestCounters){
+    auto provider = std::make_shared<TestSessionProvider>();
+    Session session(provider);
+    SessionStats stats = session.getStats();
+    EXPECT_EQ(stats.id, session.getID());
+    EXPECT_EQ(stats.messagesIn, 0u);
+    EXPECT_EQ(stats.messagesOut, 0u);
+    EXPECT_EQ(stats.lastActivity, stats.connectedAt);
+
+    provider->recordInbound(5);
+    provider->recordInbound(0);
+    provider->recordOutbound(7);
+    stats = session.getStats();
+    EXPECT_EQ(stats.messagesIn, 2u);
+    EXPECT_EQ(stats.bytesIn, 5u);
+    EXPECT_EQ(stats.messagesOut, 1u);
+    EXPECT_EQ(stats.bytesOut, 7u);
+    EXPECT_GE(stats.lastActivity, stats.connectedAt);
+    EXPECT_EQ(stats.queueDepth, 0u);
+}
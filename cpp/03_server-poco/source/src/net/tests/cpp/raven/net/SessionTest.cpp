@@ -0,0 +1,224 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/net/TypedWebSocketController.h"
+#include "raven/net/WebSocketControllerBinding.h"
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/WebSocketWriter.h"
+#include "raven/net/WebSocketHandler.h"
+#include "raven/net/WebSocketOptions.h"
+
+#include "TestSessionProvider.h"
+
+using raven::net::Session;
+using raven::net::Message;
+using raven::net::TypedWebSocketController;
+using raven::net::WebSocketControllerBinding;
+using raven::net::SessionReplayBuffer;
+using raven::net::SessionID;
+using raven::net::WebSocketWriter;
+using raven::net::WebSocketHandler;
+using raven::net::WebSocketOptions;
+using raven::net::MessagePriority;
+using raven::net::SendStatus;
+
+/**
+ * Records all events dispatched to it and echoes text messages.
+ */
+class RecordingController
+    : public TypedWebSocketController<RecordingController> {
+public:
+    std::vector<std::string> events;
+    void onConnect(Session& session){
+        events.push_back("connect");
+    }
+    void onDisconnect(Session& session){
+        events.push_back("disconnect");
+    }
+    void onMessageReceived(Session& session, Message& message){
+        events.push_back("message:" + message.getText());
+        session.send("echo:" + message.getText());
+    }
+    void onPingReceived(Session& session, Message& message){
+        events.push_back("ping:" + message.getText());
+    }
+    void onPongReceived(Session& session, Message& message){
+        events.push_back("pong:" + message.getText());
+    }
+    void onSlowConsumer(Session& session){
+        events.push_back("slow");
+    }
+    void onError(Session& session, const std::exception& ex){
+        events.push_back(std::string("error:") + ex.what());
+    }
+};
+
+/**
+ * Only handles data messages and relies on the defaults for everything else.
+ */
+class MessageOnlyController
+    : public TypedWebSocketController<MessageOnlyController> {
+public:
+    int messages = 0;
+    void onMessageReceived(Session& session, Message& message){
+        ++messages;
+    }
+};
+
+TEST(SessionTest, TestControllerBindingDispatch){
+    auto provider = std::make_shared<TestSessionProvider>();
+    Session session(provider);
+    RecordingController controller;
+    WebSocketControllerBinding binding =
+        WebSocketControllerBinding::of(controller);
+
+    EXPECT_EQ(binding.controller, static_cast<void*>(&controller));
+
+    Message text(1, "hello");
+    Message binary(4, "bytes");
+    Message ping(2, "p1");
+    Message pong(3, "p2");
+    std::runtime_error error("failure");
+
+    binding.onConnect(binding.controller, session);
+    binding.onMessage(binding.controller, session, text);
+    binding.onMessage(binding.controller, session, ping);
+    binding.onMessage(binding.controller, session, pong);
+    binding.onMessage(binding.controller, session, binary);
+    binding.onSlowConsumer(binding.controller, session);
+    binding.onError(binding.controller, session, error);
+    binding.onDisconnect(binding.controller, session);
+
+    std::vector<std::string> expected = {
+        "connect",
+        "message:hello",
+        "ping:p1",
+        "pong:p2",
+        "message:bytes",
+        "slow",
+        "error:failure",
+        "disconnect"
+    };
+    EXPECT_EQ(controller.events, expected);
+
+    std::vector<std::string> sent = {"echo:hello", "echo:bytes"};
+    EXPECT_EQ(provider->getSent(), sent);
+}
+
+TEST(SessionTest, TestControllerBindingDefaults){
+    auto provider = std::make_shared<TestSessionProvider>();
+    Session session(provider);
+    MessageOnlyController controller;
+    WebSocketControllerBinding binding =
+        WebSocketControllerBinding::of(controller);
+
+    Message text(1, "hello");
+    Message ping(2, "p1");
+    Message pong(3, "p2");
+    std::runtime_error error("failure");
+
+    binding.onConnect(binding.controller, session);
+    binding.onMessage(binding.controller, session, ping);
+    binding.onMessage(binding.controller, session, pong);
+    binding.onMessage(binding.controller, session, text);
+    binding.onError(binding.controller, session, error);
+    binding.onDisconnect(binding.controller, session);
+
+    //Control messages must not reach the data message handler
+    EXPECT_EQ(controller.messages, 1);
+    EXPECT_TRUE(provider->getSent().empty());
+}
+
+TEST(SessionTest, TestSessionRequiresProvider){
+    EXPECT_THROW(Session session(nullptr), std::runtime_error);
+}
+
+TEST(SessionTest, TestReplayBufferCallbackMaySendAgain){
+    SessionReplayBuffer replay(SessionID::generate(), "token", "/ws", 8);
+    std::vector<SendStatus> statuses;
+    auto resend = [&](SendStatus status, std::size_t depth){
+        statuses.push_back(status);
+        if(statuses.size() == 1){
+            //Would deadlock if the callback was called under the lock
+            replay.send(
+                std::make_shared<Message>("second"),
+                MessagePriority::INTERACTIVE,
+                [&](SendStatus s, std::size_t d){ statuses.push_back(s); });
+        }
+    };
+
+    replay.send(
+        std::make_shared<Message>("first"),
+        MessagePriority::INTERACTIVE,
+        resend);
+
+    //Without an attached writer messages are kept for replay
+    ASSERT_EQ(statuses.size(), 2u);
+    EXPECT_EQ(statuses[0], SendStatus::BUFFERED);
+    EXPECT_EQ(statuses[1], SendStatus::BUFFERED);
+
+    //A writer whose queue is closed drops all messages
+    RecordingController controller;
+    WebSocketWriter writer(std::make_shared<WebSocketHandler>(
+        WebSocketControllerBinding::of(controller),
+        WebSocketOptions()));
+
+    replay.attach(writer);
+    writer.getQueue().close();
+    statuses.clear();
+    replay.send(
+        std::make_shared<Message>("third"),
+        MessagePriority::INTERACTIVE,
+        resend);
+
+    ASSERT_EQ(statuses.size(), 2u);
+    EXPECT_EQ(statuses[0], SendStatus::DROPPED);
+    EXPECT_EQ(statuses[1], SendStatus::DROPPED);
+    replay.detach(writer);
+}
+
+TEST(SessionTest, TestPingIsAnsweredOnControlLane){
+    auto provider = std::make_shared<TestSessionProvider>();
+    RecordingController controller;
+    auto handler = std::make_shared<WebSocketHandler>(
+        WebSocketControllerBinding::of(controller),
+        WebSocketOptions());
+
+    handler->setSession(std::make_shared<Session>(provider));
+    Message ping(2, "heartbeat");
+    handler->process(ping);
+
+    //The controller is still notified of the ping
+    EXPECT_EQ(controller.events, std::vector<std::string>{"ping:heartbeat"});
+    EXPECT_EQ(provider->getSent(), std::vector<std::string>{"heartbeat"});
+    EXPECT_EQ(provider->getPriorities(),
+              std::vector<MessagePriority>{MessagePriority::CONTROL});
+
+    ASSERT_NE(provider->lastMessage, nullptr);
+    EXPECT_TRUE(provider->lastMessage->isPong());
+    handler->setSession(nullptr);
+}
+
+TEST(SessionTest, TestSendPing){
+    auto provider = std::make_shared<TestSessionProvider>();
+    Session session(provider);
+    session.sendPing("p");
+    EXPECT_EQ(provider->getPriorities(),
+              std::vector<MessagePriority>{MessagePriority::CONTROL});
+
+    ASSERT_NE(provider->lastMessage, nullptr);
+    EXPECT_TRUE(provider->lastMessage->isPing());
+    //Control frames cannot carry more than 125 bytes
+    EXPECT_THROW(session.sendPing(std::string(126, 'x')), std::runtime_error);
+    EXPECT_EQ(provider->getSent().size(), 1u);
+}
@@ -0,0 +1,110 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "raven/net/Message.h"
+#include "raven/net/WebSocketOptions.h"
+
+#include "raven/net/SlowConsumerDetector.h"
+#include "raven/net/WebSocketWriter.h"
+
+using raven::net::Message;
+using raven::net::MessagePriority;
+using raven::net::SlowConsumerDetector;
+using raven::net::WebSocketOptions;
+using raven::net::WebSocketWriterQueue;
+using raven::net::WSWQ_Item;
+
+static void addMessages(WebSocketWriterQueue& queue, int count){
+    for(int i = 0; i < count; ++i){
+        queue.add(WSWQ_Item{
+            false,
+            std::make_shared<Message>("message"),
+            MessagePriority::INTERACTIVE,
+            nullptr});
+    }
+}
+
+static void drain(WebSocketWriterQueue& queue){
+    while(queue.size() > 0){
+        queue.get();
+    }
+}
+
+TEST(SlowConsumerDetectorTest, TestDisabledByDefault){
+    SlowConsumerDetector detector{WebSocketOptions()};
+    WebSocketWriterQueue queue;
+    addMessages(queue, 1000);
+    EXPECT_FALSE(detector.isEnabled());
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_FALSE(detector.isLagging());
+}
+
+TEST(SlowConsumerDetectorTest, TestDepthThreshold){
+    WebSocketOptions options;
+    options.slowConsumerQueueDepth = 3;
+    SlowConsumerDetector detector(options);
+    WebSocketWriterQueue queue;
+    EXPECT_TRUE(detector.isEnabled());
+    addMessages(queue, 3);
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_FALSE(detector.isLagging());
+    addMessages(queue, 1);
+    EXPECT_TRUE(detector.check(queue));
+    EXPECT_TRUE(detector.isLagging());
+    //Only the start of the lag is reported
+    addMessages(queue, 1);
+    EXPECT_FALSE(detector.check(queue));
+    //Still lagging until the queue is drained
+    queue.get();
+    queue.get();
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_TRUE(detector.isLagging());
+    drain(queue);
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_FALSE(detector.isLagging());
+    addMessages(queue, 4);
+    EXPECT_TRUE(detector.check(queue));
+    EXPECT_FALSE(detector.isEvicted());
+}
+
+TEST(SlowConsumerDetectorTest, TestAgeThreshold){
+    WebSocketOptions options;
+    options.slowConsumerQueueAge = std::chrono::milliseconds(20);
+    SlowConsumerDetector detector(options);
+    WebSocketWriterQueue queue;
+    addMessages(queue, 1);
+    EXPECT_FALSE(detector.check(queue));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    //The age grows without further messages being added
+    EXPECT_TRUE(detector.check(queue));
+    EXPECT_TRUE(detector.isLagging());
+    drain(queue);
+    EXPECT_FALSE(detector.check(queue));
+    addMessages(queue, 1);
+    EXPECT_FALSE(detector.check(queue));
+}
+
+TEST(SlowConsumerDetectorTest, TestEviction){
+    WebSocketOptions options;
+    options.slowConsumerQueueDepth = 1;
+    options.evictSlowConsumers = true;
+    SlowConsumerDetector detector(options);
+    WebSocketWriterQueue queue;
+    addMessages(queue, 1);
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_FALSE(detector.isEvicted());
+    addMessages(queue, 1);
+    EXPECT_TRUE(detector.check(queue));
+    EXPECT_TRUE(detector.isEvicted());
+    //An evicted session remains evicted
+    drain(queue);
+    EXPECT_FALSE(detector.check(queue));
+    EXPECT_FALSE(detector.isLagging());
+    EXPECT_TRUE(detector.isEvicted());
+}
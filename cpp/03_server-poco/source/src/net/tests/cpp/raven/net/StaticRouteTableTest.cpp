@@ -0,0 +1,54 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+
+#include "raven/net/StaticRouteTable.h"
+
+using raven::net::StaticRouteTable;
+
+TEST(StaticRouteTableTest, TestEmptyTable){
+    StaticRouteTable table({});
+    EXPECT_EQ(table.find("/"), StaticRouteTable::NO_ROUTE);
+    EXPECT_EQ(table.find(""), StaticRouteTable::NO_ROUTE);
+}
+
+TEST(StaticRouteTableTest, TestFindAllRoutes){
+    std::vector<std::pair<std::string, std::size_t>> routes;
+    //Paths of all lengths around the eight byte words of the hash,
+    //and paths which only differ in their last byte
+    std::string path = "/";
+    for(std::size_t i = 0; i < 40; ++i){
+        routes.emplace_back(path, routes.size());
+        path.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    for(std::size_t i = 0; i < 1000; ++i){
+        routes.emplace_back("/api/items/" + std::to_string(i), routes.size());
+    }
+    routes.emplace_back("", routes.size());
+    StaticRouteTable table(routes);
+    for(const auto& route : routes){
+        EXPECT_EQ(table.find(route.first), route.second) << route.first;
+    }
+    //Probes must stop at the first empty slot
+    EXPECT_EQ(table.find("/api/items/1000"), StaticRouteTable::NO_ROUTE);
+    EXPECT_EQ(table.find("/api/items/"), StaticRouteTable::NO_ROUTE);
+    EXPECT_EQ(table.find("/api/items/1/"), StaticRouteTable::NO_ROUTE);
+    EXPECT_EQ(table.find("/API/items/1"), StaticRouteTable::NO_ROUTE);
+    EXPECT_EQ(table.find("/abcdefgh0"), StaticRouteTable::NO_ROUTE);
+}
+
+TEST(StaticRouteTableTest, TestLookupWithViews){
+    StaticRouteTable table({{"/users", 7}, {"/users/me", 8}});
+    const std::string uri = "/users/me?x=1";
+    const std::string_view path(uri.data(), uri.find('?'));
+    EXPECT_EQ(table.find(path), 8u);
+    EXPECT_EQ(table.find(path.substr(0, 6)), 7u);
+    EXPECT_EQ(table.find(path.substr(0, 7)), StaticRouteTable::NO_ROUTE);
+}
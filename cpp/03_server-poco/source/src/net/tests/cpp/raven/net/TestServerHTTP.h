@@ -0,0 +1,140 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#ifndef RAVEN_NET_TEST_SERVER_HTTP_H
+#define RAVEN_NET_TEST_SERVER_HTTP_H
+
+#include <memory>
+#include <string>
+#include <sstream>
+#include <functional>
+
+#include "Poco/StreamCopier.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/SocketAddress.h"
+
+#include "raven/net/RouterHTTP.h"
+#include "raven/net/DefaultRequestHandlerFactory.h"
+
+
+/**
+ * Router whose routes are defined by a function given by the test.
+ */
+class TestRouterHTTP : public raven::net::BasicRouterHTTP {
+
+public:
+
+    std::function<void(TestRouterHTTP&)> routes;
+
+    TestRouterHTTP(std::function<void(TestRouterHTTP&)> routes)
+        : routes(routes){ }
+
+    void defineRoutes(){
+        routes(*this);
+    }
+};
+
+/**
+ * HTTP server on a loopback port which dispatches all requests to
+ * the specified router, together with a client for sending requests.
+ */
+class TestServerHTTP {
+
+    Poco::Net::ServerSocket _socket;
+    Poco::Net::HTTPServer _server;
+
+public:
+
+    TestServerHTTP(std::shared_ptr<raven::net::RouterHTTP> router)
+        : _socket(Poco::Net::SocketAddress("127.0.0.1", 0)),
+          _server(
+              new raven::net::DefaultRequestHandlerFactory(router),
+              _socket,
+              new Poco::Net::HTTPServerParams()){
+
+        router->initialize();
+        _server.start();
+    }
+
+    ~TestServerHTTP(){
+        _server.stop();
+    }
+
+    /**
+     * Sends a request and returns the body of the response.
+     */
+    std::string send(
+        const std::string& method,
+        const std::string& uri,
+        Poco::Net::HTTPResponse& response){
+
+        return send(method, uri, std::string(), response);
+    }
+
+    /**
+     * Sends a request with the specified body and
+     * returns the body of the response.
+     */
+    std::string send(
+        const std::string& method,
+        const std::string& uri,
+        const std::string& body,
+        Poco::Net::HTTPResponse& response){
+
+        Poco::Net::HTTPRequest request(
+            method, uri, Poco::Net::HTTPRequest::HTTP_1_1);
+
+        if(!body.empty()){
+            request.setContentLength(static_cast<std::streamsize>(body.size()));
+        }
+        return send(request, body, response);
+    }
+
+    /**
+     * Sends the specified request, e.g. with custom headers, together
+     * with the specified body and returns the body of the response.
+     */
+    std::string send(
+        Poco::Net::HTTPRequest& request,
+        const std::string& body,
+        Poco::Net::HTTPResponse& response){
+
+        Poco::Net::HTTPClientSession session(
+            "127.0.0.1", _socket.address().port());
+
+        session.sendRequest(request) << body;
+        std::istream& in = session.receiveResponse(response);
+        std::ostringstream out;
+        Poco::StreamCopier::copyStream(in, out);
+        return out.str();
+    }
+
+    /**
+     * Sends the specified request together with the specified body, which
+     * may be shorter than the declared Content-Length, and then closes the
+     * sending side of the connection. Returns the body of the response.
+     */
+    std::string sendTruncated(
+        Poco::Net::HTTPRequest& request,
+        const std::string& body,
+        Poco::Net::HTTPResponse& response){
+
+        Poco::Net::HTTPClientSession session(
+            "127.0.0.1", _socket.address().port());
+
+        std::ostream& os = session.sendRequest(request);
+        os << body;
+        os.flush();
+        session.socket().shutdownSend();
+        std::istream& in = session.receiveResponse(response);
+        std::ostringstream out;
+        Poco::StreamCopier::copyStream(in, out);
+        return out.str();
+    }
+};
+
+#endif // RAVEN_NET_TEST_SERVER_HTTP_H
@@ -0,0 +1,106 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#ifndef RAVEN_NET_TEST_SESSION_PROVIDER_H
+#define RAVEN_NET_TEST_SESSION_PROVIDER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+#include "raven/net/Session.h"
+#include "raven/net/Message.h"
+#include "raven/net/SessionID.h"
+#include "raven/net/SessionReplayBuffer.h"
+#include "raven/net/WebSocketOptions.h"
+#include "raven/net/WebSocketSessionProvider.h"
+
+
+/**
+ * Session provider test double without a connection, which records all
+ * outbound messages instead of writing them to a web socket. Callbacks
+ * of send operations are called synchronously with the configured status.
+ */
+class TestSessionProvider : public raven::net::WebSocketSessionProvider {
+
+    mutable std::mutex _mutex;
+    std::vector<std::string> _sent;
+    std::vector<raven::net::MessagePriority> _priorities;
+
+public:
+
+    raven::net::SendStatus status = raven::net::SendStatus::WRITTEN;
+
+    //Called for each outbound message, before its callback is called
+    std::function<void(const std::string&)> onSend;
+
+    //The last outbound message
+    std::shared_ptr<raven::net::Message> lastMessage;
+
+    TestSessionProvider()
+        : TestSessionProvider(raven::net::WebSocketOptions()){ }
+
+    TestSessionProvider(const raven::net::WebSocketOptions& options)
+        : TestSessionProvider(
+              raven::net::SessionID::generate(), options, nullptr){ }
+
+    //Messages are kept by the replay buffer, as if disconnected
+    TestSessionProvider(
+        std::shared_ptr<raven::net::SessionReplayBuffer> replay)
+        : TestSessionProvider(
+              replay->getID(), raven::net::WebSocketOptions(), replay){ }
+
+    TestSessionProvider(
+        const raven::net::SessionID& id,
+        const raven::net::WebSocketOptions& options,
+        std::shared_ptr<raven::net::SessionReplayBuffer> replay)
+        : WebSocketSessionProvider(
+              id,
+              options,
+              replay,
+              [this](std::shared_ptr<raven::net::Message> msg,
+                     raven::net::MessagePriority priority,
+                     raven::net::SendCallback done){
+
+                  record(msg, priority, done);
+              }){ }
+
+    std::vector<std::string> getSent() const{
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _sent;
+    }
+
+    std::vector<raven::net::MessagePriority> getPriorities() const{
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _priorities;
+    }
+
+private:
+
+    void record(
+        std::shared_ptr<raven::net::Message> msg,
+        raven::net::MessagePriority priority,
+        raven::net::SendCallback done){
+
+        const std::string data(msg->getData(), msg->getSize());
+        std::size_t depth = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _sent.push_back(data);
+            _priorities.push_back(priority);
+            lastMessage = msg;
+            depth = _sent.size();
+        }
+        if(onSend){
+            onSend(data);
+        }
+        if(done){
+            done(status, depth);
+        }
+    }
+
+}; // END CLASS TestSessionProvider
+
+#endif // RAVEN_NET_TEST_SESSION_PROVIDER_H
@@ -0,0 +1,137 @@
+${{VAR_COPYRIGHT_HEADER}}
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+
+#include "raven/net/Message.h"
+#include "raven/net/WebSocketWriter.h"
+
+using raven::net::Message;
+using raven::net::MessagePriority;
+using raven::net::WSWQ_Item;
+using raven::net::WebSocketWriterQueue;
+
+static void add(
+    WebSocketWriterQueue& queue,
+    const std::string& text,
+    MessagePriority priority){
+
+    ASSERT_TRUE(queue.add(
+        WSWQ_Item{false, std::make_shared<Message>(text), priority, nullptr}));
+}
+
+/**
+ * Takes the specified number of items from the queue and returns
+ * the texts of their messages, in the order they were returned.
+ */
+static std::vector<std::string> take(
+    WebSocketWriterQueue& queue,
+    std::size_t count){
+
+    std::vector<std::string> texts;
+    for(std::size_t i = 0; i < count; ++i){
+        WSWQ_Item item = queue.get();
+        texts.push_back(item.cancel ? "cancel" : item.msg->getText());
+    }
+    return texts;
+}
+
+TEST(WebSocketWriterQueueTest, TestControlLaneIsServedFirst){
+    WebSocketWriterQueue queue;
+    add(queue, "b1", MessagePriority::BULK);
+    add(queue, "i1", MessagePriority::INTERACTIVE);
+    add(queue, "c1", MessagePriority::CONTROL);
+    add(queue, "c2", MessagePriority::CONTROL);
+    EXPECT_EQ(take(queue, 2), (std::vector<std::string>{"c1", "c2"}));
+
+    add(queue, "c3", MessagePriority::CONTROL);
+    EXPECT_EQ(take(queue, 1), std::vector<std::string>{"c3"});
+    EXPECT_EQ(take(queue, 2), (std::vector<std::string>{"i1", "b1"}));
+}
+
+TEST(WebSocketWriterQueueTest, TestWeightedRoundRobin){
+    WebSocketWriterQueue queue;
+    for(int i = 0; i < 20; ++i){
+        add(queue, "i", MessagePriority::INTERACTIVE);
+    }
+    for(int i = 0; i < 5; ++i){
+        add(queue, "b", MessagePriority::BULK);
+    }
+    std::vector<std::string> expected;
+    expected.insert(expected.end(), 8, "i");
+    expected.push_back("b");
+    expected.insert(expected.end(), 8, "i");
+    expected.push_back("b");
+    //Bulk items are served back to back once interactive items run out
+    expected.insert(expected.end(), 4, "i");
+    expected.insert(expected.end(), 3, "b");
+    EXPECT_EQ(take(queue, 25), expected);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(WebSocketWriterQueueTest, TestSingleLaneIsNotThrottled){
+    WebSocketWriterQueue queue;
+    for(int i = 0; i < 20; ++i){
+        add(queue, "b", MessagePriority::BULK);
+    }
+    EXPECT_EQ(take(queue, 20), std::vector<std::string>(20, "b"));
+    for(int i = 0; i < 20; ++i){
+        add(queue, "i", MessagePriority::INTERACTIVE);
+    }
+    EXPECT_EQ(take(queue, 20), std::vector<std::string>(20, "i"));
+}
+
+TEST(WebSocketWriterQueueTest, TestLaneDepth){
+    WebSocketWriterQueue queue;
+    add(queue, "c", MessagePriority::CONTROL);
+    add(queue, "i1", MessagePriority::INTERACTIVE);
+    add(queue, "i2", MessagePriority::INTERACTIVE);
+    add(queue, "b1", MessagePriority::BULK);
+    add(queue, "b2", MessagePriority::BULK);
+    add(queue, "b3", MessagePriority::BULK);
+    EXPECT_EQ(queue.size(MessagePriority::CONTROL), 1u);
+    EXPECT_EQ(queue.size(MessagePriority::INTERACTIVE), 2u);
+    EXPECT_EQ(queue.size(MessagePriority::BULK), 3u);
+    EXPECT_EQ(queue.size(), 6u);
+
+    take(queue, 2);
+    EXPECT_EQ(queue.size(MessagePriority::CONTROL), 0u);
+    EXPECT_EQ(queue.size(MessagePriority::INTERACTIVE), 1u);
+    EXPECT_EQ(queue.size(MessagePriority::BULK), 3u);
+    EXPECT_EQ(queue.size(), 4u);
+}
+
+TEST(WebSocketWriterQueueTest, TestCancellationAfterDrain){
+    WebSocketWriterQueue queue;
+    add(queue, "i", MessagePriority::INTERACTIVE);
+    add(queue, "b", MessagePriority::BULK);
+    ASSERT_TRUE(queue.add(WSWQ_Item{true, nullptr}));
+    add(queue, "c", MessagePriority::CONTROL);
+    EXPECT_EQ(take(queue, 4),
+              (std::vector<std::string>{"c", "i", "b", "cancel"}));
+}
+
+TEST(WebSocketWriterQueueTest, TestClose){
+    WebSocketWriterQueue queue;
+    add(queue, "b", MessagePriority::BULK);
+    add(queue, "i", MessagePriority::INTERACTIVE);
+    add(queue, "c", MessagePriority::CONTROL);
+    std::deque<WSWQ_Item> remaining = queue.close();
+    ASSERT_EQ(remaining.size(), 3u);
+    //Remaining items are returned in lane order
+    EXPECT_EQ(remaining[0].msg->getText(), "c");
+    EXPECT_EQ(remaining[1].msg->getText(), "i");
+    EXPECT_EQ(remaining[2].msg->getText(), "b");
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.add(WSWQ_Item{
+        false,
+        std::make_shared<Message>("late"),
+        MessagePriority::CONTROL,
+        nullptr}));
+}